@@ -0,0 +1,15 @@
+/*
+ * orbisGl2 headless host shim for debugnet
+ * Log lines are written to stdout instead of the udp log listener
+ */
+#pragma once
+
+#define NONE 0
+#define INFO 1
+#define ERROR 2
+#define DEBUG 3
+
+int debugNetInit(const char *serverIp, int port, int level);   // Host: only log level is used
+void debugNetFinish(void);
+void debugNetSetLogLevel(int level);                           // Messages above level are discarded (default INFO)
+void debugNetPrintf(int level, const char *format, ...) __attribute__((format(printf,2,3)));
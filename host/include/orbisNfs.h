@@ -0,0 +1,17 @@
+/*
+ * orbisGl2 headless host shim for orbisNfs
+ * Paths are resolved on the local file system with POSIX file I/O
+ */
+#pragma once
+
+#include <sys/types.h>
+
+int orbisNfsInit(const char *url);                             // Host: url is ignored
+void orbisNfsFinish(void);
+int orbisNfsOpen(const char *file, int flags, int mode);
+int orbisNfsRead(int fd, void *data, int size);
+int orbisNfsWrite(int fd, const void *data, int size);
+int orbisNfsLseek(int fd, int offset, int whence);
+int orbisNfsClose(int fd);
+unsigned char *orbisNfsGetFileContent(const char *filename);   // Returns malloc'ed file content (NULL on failure)
+int orbisNfsGetFileContentLength(const char *filename);        // Returns file size (-1 on failure)
@@ -0,0 +1,37 @@
+/*
+ * orbisGl2 headless host shim for piglet
+ * Only the configuration types used by orbisGlInit() are provided
+ */
+#pragma once
+
+#include <stdint.h>
+
+#define SCE_PGL_FLAGS_USE_COMPOSITE_EXT     0x1
+#define SCE_PGL_FLAGS_USE_FLEXIBLE_MEMORY   0x2
+
+typedef struct ScePglConfig
+{
+	uint32_t size;
+	uint32_t flags;
+	uint8_t processOrder;
+	uint32_t unk_0x0C[2];
+	uint32_t systemSharedMemorySize;
+	uint32_t videoSharedMemorySize;
+	uint32_t maxMappedFlexibleMemory;
+	uint32_t drawCommandBufferSize;
+	uint32_t lcueResourceBufferSize;
+	uint32_t dbgPosCmd_0x40;
+	uint32_t dbgPosCmd_0x44;
+	uint32_t dbgPosCmd_0x48;
+	uint32_t dbgPosCmd_0x4C;
+	uint32_t unk_0x5C;
+} ScePglConfig;
+
+typedef struct SceWindow
+{
+	uint32_t id;
+	uint32_t width;
+	uint32_t height;
+} SceWindow;
+
+int scePigletSetConfigurationVSH(const ScePglConfig *config);
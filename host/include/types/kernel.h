@@ -0,0 +1,7 @@
+/*
+ * orbisGl2 headless host shim for ps4sdk kernel types
+ */
+#pragma once
+
+#include <time.h>
+#include <sys/types.h>
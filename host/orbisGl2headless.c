@@ -0,0 +1,433 @@
+/*
+ * orbisGl2 headless backend
+ * GL ES2/EGL/piglet entry points used by orbisGl2, recorded into an in-memory command log
+ * instead of being executed. Lets batching, meshes and text CPU cost be measured on a host
+ * without GPU (build with Makefile.host, ORBISGL_HEADLESS defined).
+ */
+#include <stdlib.h>
+#include <string.h>
+#include <debugnet.h>
+#include <orbisGl2.h>
+
+#define HEADLESS_MAX_COMMAND_IDS    128     // Maximum number of distinct GL entry points recorded
+#define HEADLESS_MAX_ATTRIBS         256    // Maximum number of attributes bound by glBindAttribLocation()
+#define HEADLESS_BINARY_FORMAT   0x4844     // Program binary format, binary data is the program bound attributes
+
+// Record a call of current GL entry point, id is registered on first call
+#define HEADLESS_RECORD(bytes) do { static int id = -1; if (id < 0) id = HeadlessRegister(__FUNCTION__); HeadlessRecord(id, bytes); } while (0)
+
+// Attribute location bound before program link
+typedef struct HeadlessAttrib {
+	unsigned int program;
+	char name[32];
+	int index;
+} HeadlessAttrib;
+
+static HeadlessLog headlessLog = { 0 };
+static int headlessCapacity = 0;
+static const char *headlessNames[HEADLESS_MAX_COMMAND_IDS] = { 0 };
+static int headlessNamesCount = 0;
+static unsigned int headlessNextObject = 1;     // Ids shared by all GL object types
+static HeadlessAttrib headlessAttribs[HEADLESS_MAX_ATTRIBS] = { 0 };
+static int headlessAttribsCount = 0;
+
+static const char *headlessExtensions = "GL_OES_vertex_array_object GL_OES_texture_npot GL_OES_texture_float "
+	"GL_OES_depth_texture GL_OES_depth24 GL_OES_element_index_uint GL_OES_get_program_binary GL_EXT_texture_filter_anisotropic";
+
+//----------------------------------------------------------------------------------
+// Command log
+//----------------------------------------------------------------------------------
+static int HeadlessRegister(const char *name)
+{
+	if (headlessNamesCount >= HEADLESS_MAX_COMMAND_IDS)
+	{
+		debugNetPrintf(ERROR, "[ORBISGL] %s [%s] Too many GL entry points, recorded as last one\n",__FUNCTION__, name);
+		return HEADLESS_MAX_COMMAND_IDS - 1;
+	}
+	headlessNames[headlessNamesCount] = name;
+	return headlessNamesCount++;
+}
+
+static void HeadlessRecord(int id, unsigned int bytes)
+{
+	if (headlessLog.commandsCount >= headlessCapacity)
+	{
+		int capacity = (headlessCapacity > 0)? headlessCapacity*2 : 4096;
+		HeadlessCommand *commands = (HeadlessCommand *)realloc(headlessLog.commands, capacity*sizeof(HeadlessCommand));
+		if (commands == NULL) return;
+		headlessLog.commands = commands;
+		headlessCapacity = capacity;
+	}
+	headlessLog.commands[headlessLog.commandsCount].id = id;
+	headlessLog.commands[headlessLog.commandsCount].bytes = bytes;
+	headlessLog.commandsCount++;
+	headlessLog.bytes += bytes;
+}
+
+// Get GL commands recorded since last reset
+// NOTE: Commands array is owned by the backend, it's valid until next recorded command
+HeadlessLog GetHeadlessLog(void)
+{
+	return headlessLog;
+}
+
+// Get GL entry point name of a recorded command
+const char *GetHeadlessCommandName(int id)
+{
+	if ((id < 0) || (id >= headlessNamesCount)) return "unknown";
+	return headlessNames[id];
+}
+
+// Clear recorded GL commands (commands storage is kept for reuse)
+void ResetHeadlessLog(void)
+{
+	headlessLog.commandsCount = 0;
+	headlessLog.bytes = 0;
+	headlessLog.swaps = 0;
+}
+
+// Log recorded GL commands count and bytes per entry point
+void PrintHeadlessLog(void)
+{
+	int counts[HEADLESS_MAX_COMMAND_IDS] = { 0 };
+	unsigned long long bytes[HEADLESS_MAX_COMMAND_IDS] = { 0 };
+	for (int i = 0; i < headlessLog.commandsCount; i++)
+	{
+		counts[headlessLog.commands[i].id]++;
+		bytes[headlessLog.commands[i].id] += headlessLog.commands[i].bytes;
+	}
+	debugNetPrintf(INFO, "[ORBISGL] %s %i commands, %llu bytes, %i frames\n",__FUNCTION__, headlessLog.commandsCount, headlessLog.bytes, headlessLog.swaps);
+	for (int id = 0; id < headlessNamesCount; id++)
+	{
+		if (counts[id] > 0) debugNetPrintf(INFO, "[ORBISGL] %s %-28s %8i calls %12llu bytes\n",__FUNCTION__, headlessNames[id], counts[id], bytes[id]);
+	}
+}
+
+//----------------------------------------------------------------------------------
+// Helpers
+//----------------------------------------------------------------------------------
+static void HeadlessGenObjects(GLsizei n, GLuint *ids)
+{
+	for (int i = 0; i < n; i++) ids[i] = headlessNextObject++;
+}
+
+// Pixel data size for a GL format/type pair
+static unsigned int HeadlessPixelsSize(GLenum format, GLenum type, GLsizei width, GLsizei height)
+{
+	unsigned int channels = 4;
+	switch (format)
+	{
+		case GL_ALPHA:
+		case GL_LUMINANCE:
+		case GL_DEPTH_COMPONENT: channels = 1; break;
+		case GL_LUMINANCE_ALPHA: channels = 2; break;
+		case GL_RGB: channels = 3; break;
+		default: break;
+	}
+	unsigned int pixelSize = channels;
+	switch (type)
+	{
+		case GL_UNSIGNED_SHORT_5_6_5:
+		case GL_UNSIGNED_SHORT_4_4_4_4:
+		case GL_UNSIGNED_SHORT_5_5_5_1: pixelSize = 2; break;
+		case GL_UNSIGNED_SHORT:
+		case GL_HALF_FLOAT_OES: pixelSize = channels*2; break;
+		case GL_UNSIGNED_INT:
+		case GL_FLOAT: pixelSize = channels*4; break;
+		default: break;
+	}
+	return (unsigned int)width*(unsigned int)height*pixelSize;
+}
+
+// Location for a name, stable for a given name
+static GLint HeadlessLocation(const GLchar *name, int range)
+{
+	unsigned int hash = 5381;
+	while (*name) hash = hash*33 + (unsigned char)*name++;
+	return (GLint)(hash%range);
+}
+
+//----------------------------------------------------------------------------------
+// Piglet and EGL
+//----------------------------------------------------------------------------------
+int scePigletSetConfigurationVSH(const ScePglConfig *config)
+{
+	return 1;
+}
+
+EGLDisplay EGLAPIENTRY eglGetDisplay(EGLNativeDisplayType display_id) { return (EGLDisplay)1; }
+EGLBoolean EGLAPIENTRY eglInitialize(EGLDisplay dpy, EGLint *major, EGLint *minor)
+{
+	if (major) *major = 1;
+	if (minor) *minor = 4;
+	return EGL_TRUE;
+}
+EGLBoolean EGLAPIENTRY eglBindAPI(EGLenum api) { return EGL_TRUE; }
+EGLBoolean EGLAPIENTRY eglSwapInterval(EGLDisplay dpy, EGLint interval) { return EGL_TRUE; }
+EGLBoolean EGLAPIENTRY eglChooseConfig(EGLDisplay dpy, const EGLint *attrib_list, EGLConfig *configs, EGLint config_size, EGLint *num_config)
+{
+	if ((configs != NULL) && (config_size > 0)) configs[0] = (EGLConfig)1;
+	*num_config = 1;
+	return EGL_TRUE;
+}
+EGLSurface EGLAPIENTRY eglCreateWindowSurface(EGLDisplay dpy, EGLConfig config, EGLNativeWindowType win, const EGLint *attrib_list) { return (EGLSurface)1; }
+EGLContext EGLAPIENTRY eglCreateContext(EGLDisplay dpy, EGLConfig config, EGLContext share_context, const EGLint *attrib_list) { return (EGLContext)1; }
+EGLBoolean EGLAPIENTRY eglMakeCurrent(EGLDisplay dpy, EGLSurface draw, EGLSurface read, EGLContext ctx) { return EGL_TRUE; }
+EGLBoolean EGLAPIENTRY eglDestroyContext(EGLDisplay dpy, EGLContext ctx) { return EGL_TRUE; }
+EGLBoolean EGLAPIENTRY eglDestroySurface(EGLDisplay dpy, EGLSurface surface) { return EGL_TRUE; }
+EGLBoolean EGLAPIENTRY eglTerminate(EGLDisplay dpy) { return EGL_TRUE; }
+EGLint EGLAPIENTRY eglGetError(void) { return EGL_SUCCESS; }
+EGLBoolean EGLAPIENTRY eglSwapBuffers(EGLDisplay dpy, EGLSurface surface)
+{
+	HEADLESS_RECORD(0);
+	headlessLog.swaps++;
+	return EGL_TRUE;
+}
+
+// VAO extension entry points, orbisGl2 loads them through eglGetProcAddress()
+void GL_APIENTRY glGenVertexArraysOES(GLsizei n, GLuint *arrays)
+{
+	HEADLESS_RECORD(0);
+	HeadlessGenObjects(n, arrays);
+}
+void GL_APIENTRY glBindVertexArrayOES(GLuint array) { HEADLESS_RECORD(0); }
+void GL_APIENTRY glDeleteVertexArraysOES(GLsizei n, const GLuint *arrays) { HEADLESS_RECORD(0); }
+
+// Program binary extension entry points, binary keeps attribute locations so they survive a reload
+void GL_APIENTRY glGetProgramBinaryOES(GLuint program, GLsizei bufSize, GLsizei *length, GLenum *binaryFormat, void *binary)
+{
+	HEADLESS_RECORD(0);
+	GLsizei size = 0;
+	for (int i = 0; i < headlessAttribsCount; i++)
+	{
+		if ((headlessAttribs[i].program == program) && (size + (GLsizei)sizeof(HeadlessAttrib) <= bufSize))
+		{
+			memcpy((unsigned char *)binary + size, &headlessAttribs[i], sizeof(HeadlessAttrib));
+			size += sizeof(HeadlessAttrib);
+		}
+	}
+	if (length != NULL) *length = size;
+	*binaryFormat = HEADLESS_BINARY_FORMAT;
+}
+void GL_APIENTRY glProgramBinaryOES(GLuint program, GLenum binaryFormat, const void *binary, GLint length)
+{
+	HEADLESS_RECORD(length);
+	if (binaryFormat != HEADLESS_BINARY_FORMAT) return;
+	for (int i = 0; (i + (GLint)sizeof(HeadlessAttrib) <= length) && (headlessAttribsCount < HEADLESS_MAX_ATTRIBS); i += sizeof(HeadlessAttrib))
+	{
+		memcpy(&headlessAttribs[headlessAttribsCount], (const unsigned char *)binary + i, sizeof(HeadlessAttrib));
+		headlessAttribs[headlessAttribsCount].program = program;
+		headlessAttribsCount++;
+	}
+}
+
+__eglMustCastToProperFunctionPointerType EGLAPIENTRY eglGetProcAddress(const char *procname)
+{
+	if (strcmp(procname, "glGenVertexArraysOES") == 0) return (__eglMustCastToProperFunctionPointerType)glGenVertexArraysOES;
+	if (strcmp(procname, "glBindVertexArrayOES") == 0) return (__eglMustCastToProperFunctionPointerType)glBindVertexArrayOES;
+	if (strcmp(procname, "glDeleteVertexArraysOES") == 0) return (__eglMustCastToProperFunctionPointerType)glDeleteVertexArraysOES;
+	if (strcmp(procname, "glGetProgramBinaryOES") == 0) return (__eglMustCastToProperFunctionPointerType)glGetProgramBinaryOES;
+	if (strcmp(procname, "glProgramBinaryOES") == 0) return (__eglMustCastToProperFunctionPointerType)glProgramBinaryOES;
+	return NULL;
+}
+
+//----------------------------------------------------------------------------------
+// GL ES2 queries
+//----------------------------------------------------------------------------------
+const GLubyte *GL_APIENTRY glGetString(GLenum name)
+{
+	switch (name)
+	{
+		case GL_VENDOR: return (const GLubyte *)"orbisdev";
+		case GL_RENDERER: return (const GLubyte *)"orbisGl2 headless";
+		case GL_VERSION: return (const GLubyte *)"OpenGL ES 2.0 headless";
+		case GL_SHADING_LANGUAGE_VERSION: return (const GLubyte *)"OpenGL ES GLSL ES 1.00";
+		case GL_EXTENSIONS: return (const GLubyte *)headlessExtensions;
+		default: return (const GLubyte *)"";
+	}
+}
+GLenum GL_APIENTRY glGetError(void) { return GL_NO_ERROR; }
+void GL_APIENTRY glGetIntegerv(GLenum pname, GLint *data)
+{
+	switch (pname)
+	{
+		case GL_MAX_TEXTURE_SIZE: *data = 8192; break;
+		case GL_MAX_VERTEX_ATTRIBS: *data = 16; break;
+		case GL_NUM_PROGRAM_BINARY_FORMATS_OES: *data = 1; break;
+		default: *data = 0; break;
+	}
+}
+void GL_APIENTRY glGetFloatv(GLenum pname, GLfloat *data)
+{
+	*data = (pname == 0x84FF)? 16.0f : 0.0f;    // GL_MAX_TEXTURE_MAX_ANISOTROPY_EXT
+}
+void GL_APIENTRY glGetShaderiv(GLuint shader, GLenum pname, GLint *params)
+{
+	*params = (pname == GL_COMPILE_STATUS)? GL_TRUE : 0;
+}
+void GL_APIENTRY glGetProgramiv(GLuint program, GLenum pname, GLint *params)
+{
+	*params = (pname == GL_LINK_STATUS)? GL_TRUE : 0;
+	if (pname == GL_PROGRAM_BINARY_LENGTH_OES)
+	{
+		for (int i = 0; i < headlessAttribsCount; i++) if (headlessAttribs[i].program == program) *params += sizeof(HeadlessAttrib);
+	}
+}
+void GL_APIENTRY glGetShaderInfoLog(GLuint shader, GLsizei bufSize, GLsizei *length, GLchar *infoLog)
+{
+	if (length) *length = 0;
+	if (bufSize > 0) infoLog[0] = '\0';
+}
+void GL_APIENTRY glGetProgramInfoLog(GLuint program, GLsizei bufSize, GLsizei *length, GLchar *infoLog)
+{
+	if (length) *length = 0;
+	if (bufSize > 0) infoLog[0] = '\0';
+}
+void GL_APIENTRY glGetActiveUniform(GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLint *size, GLenum *type, GLchar *name)
+{
+	if (length) *length = 0;
+	if (bufSize > 0) name[0] = '\0';
+	*size = 0;
+	*type = GL_FLOAT;
+}
+GLint GL_APIENTRY glGetAttribLocation(GLuint program, const GLchar *name)
+{
+	HEADLESS_RECORD(0);
+	for (int i = 0; i < headlessAttribsCount; i++)
+	{
+		if ((headlessAttribs[i].program == program) && (strcmp(headlessAttribs[i].name, name) == 0)) return headlessAttribs[i].index;
+	}
+	return HeadlessLocation(name, 16);
+}
+GLint GL_APIENTRY glGetUniformLocation(GLuint program, const GLchar *name)
+{
+	HEADLESS_RECORD(0);
+	return HeadlessLocation(name, 1024);
+}
+GLenum GL_APIENTRY glCheckFramebufferStatus(GLenum target)
+{
+	HEADLESS_RECORD(0);
+	return GL_FRAMEBUFFER_COMPLETE;
+}
+void GL_APIENTRY glReadPixels(GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, void *pixels)
+{
+	unsigned int size = HeadlessPixelsSize(format, type, width, height);
+	HEADLESS_RECORD(size);
+	memset(pixels, 0, size);
+}
+
+//----------------------------------------------------------------------------------
+// GL ES2 objects
+//----------------------------------------------------------------------------------
+void GL_APIENTRY glGenBuffers(GLsizei n, GLuint *buffers) { HEADLESS_RECORD(0); HeadlessGenObjects(n, buffers); }
+void GL_APIENTRY glGenTextures(GLsizei n, GLuint *textures) { HEADLESS_RECORD(0); HeadlessGenObjects(n, textures); }
+void GL_APIENTRY glGenFramebuffers(GLsizei n, GLuint *framebuffers) { HEADLESS_RECORD(0); HeadlessGenObjects(n, framebuffers); }
+void GL_APIENTRY glGenRenderbuffers(GLsizei n, GLuint *renderbuffers) { HEADLESS_RECORD(0); HeadlessGenObjects(n, renderbuffers); }
+void GL_APIENTRY glDeleteBuffers(GLsizei n, const GLuint *buffers) { HEADLESS_RECORD(0); }
+void GL_APIENTRY glDeleteTextures(GLsizei n, const GLuint *textures) { HEADLESS_RECORD(0); }
+void GL_APIENTRY glDeleteFramebuffers(GLsizei n, const GLuint *framebuffers) { HEADLESS_RECORD(0); }
+void GL_APIENTRY glDeleteRenderbuffers(GLsizei n, const GLuint *renderbuffers) { HEADLESS_RECORD(0); }
+void GL_APIENTRY glBindBuffer(GLenum target, GLuint buffer) { HEADLESS_RECORD(0); }
+void GL_APIENTRY glBindTexture(GLenum target, GLuint texture) { HEADLESS_RECORD(0); }
+void GL_APIENTRY glBindFramebuffer(GLenum target, GLuint framebuffer) { HEADLESS_RECORD(0); }
+void GL_APIENTRY glBindRenderbuffer(GLenum target, GLuint renderbuffer) { HEADLESS_RECORD(0); }
+void GL_APIENTRY glActiveTexture(GLenum texture) { HEADLESS_RECORD(0); }
+void GL_APIENTRY glFramebufferTexture2D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level) { HEADLESS_RECORD(0); }
+void GL_APIENTRY glFramebufferRenderbuffer(GLenum target, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer) { HEADLESS_RECORD(0); }
+void GL_APIENTRY glRenderbufferStorage(GLenum target, GLenum internalformat, GLsizei width, GLsizei height) { HEADLESS_RECORD(0); }
+
+void GL_APIENTRY glBufferData(GLenum target, GLsizeiptr size, const void *data, GLenum usage)
+{
+	HEADLESS_RECORD((data != NULL)? (unsigned int)size : 0);
+}
+void GL_APIENTRY glBufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, const void *data)
+{
+	HEADLESS_RECORD((unsigned int)size);
+}
+void GL_APIENTRY glTexImage2D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type, const void *pixels)
+{
+	HEADLESS_RECORD((pixels != NULL)? HeadlessPixelsSize(format, type, width, height) : 0);
+}
+void GL_APIENTRY glTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *pixels)
+{
+	HEADLESS_RECORD(HeadlessPixelsSize(format, type, width, height));
+}
+void GL_APIENTRY glCompressedTexImage2D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLint border, GLsizei imageSize, const void *data)
+{
+	HEADLESS_RECORD((unsigned int)imageSize);
+}
+void GL_APIENTRY glTexParameteri(GLenum target, GLenum pname, GLint param) { HEADLESS_RECORD(0); }
+void GL_APIENTRY glTexParameterf(GLenum target, GLenum pname, GLfloat param) { HEADLESS_RECORD(0); }
+void GL_APIENTRY glGenerateMipmap(GLenum target) { HEADLESS_RECORD(0); }
+void GL_APIENTRY glPixelStorei(GLenum pname, GLint param) { HEADLESS_RECORD(0); }
+
+//----------------------------------------------------------------------------------
+// GL ES2 shaders
+//----------------------------------------------------------------------------------
+GLuint GL_APIENTRY glCreateShader(GLenum type) { HEADLESS_RECORD(0); return headlessNextObject++; }
+GLuint GL_APIENTRY glCreateProgram(void) { HEADLESS_RECORD(0); return headlessNextObject++; }
+void GL_APIENTRY glShaderSource(GLuint shader, GLsizei count, const GLchar *const*string, const GLint *length)
+{
+	unsigned int bytes = 0;
+	for (int i = 0; i < count; i++) bytes += ((length != NULL) && (length[i] >= 0))? (unsigned int)length[i] : (unsigned int)strlen(string[i]);
+	HEADLESS_RECORD(bytes);
+}
+void GL_APIENTRY glCompileShader(GLuint shader) { HEADLESS_RECORD(0); }
+void GL_APIENTRY glAttachShader(GLuint program, GLuint shader) { HEADLESS_RECORD(0); }
+void GL_APIENTRY glDetachShader(GLuint program, GLuint shader) { HEADLESS_RECORD(0); }
+void GL_APIENTRY glBindAttribLocation(GLuint program, GLuint index, const GLchar *name)
+{
+	HEADLESS_RECORD(0);
+	if (headlessAttribsCount < HEADLESS_MAX_ATTRIBS)
+	{
+		headlessAttribs[headlessAttribsCount].program = program;
+		strncpy(headlessAttribs[headlessAttribsCount].name, name, sizeof(headlessAttribs[0].name) - 1);
+		headlessAttribs[headlessAttribsCount].index = index;
+		headlessAttribsCount++;
+	}
+}
+void GL_APIENTRY glLinkProgram(GLuint program) { HEADLESS_RECORD(0); }
+void GL_APIENTRY glUseProgram(GLuint program) { HEADLESS_RECORD(0); }
+void GL_APIENTRY glDeleteShader(GLuint shader) { HEADLESS_RECORD(0); }
+void GL_APIENTRY glDeleteProgram(GLuint program) { HEADLESS_RECORD(0); }
+
+void GL_APIENTRY glUniform1i(GLint location, GLint v0) { HEADLESS_RECORD(sizeof(GLint)); }
+void GL_APIENTRY glUniform1f(GLint location, GLfloat v0) { HEADLESS_RECORD(sizeof(GLfloat)); }
+void GL_APIENTRY glUniform4f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3) { HEADLESS_RECORD(4*sizeof(GLfloat)); }
+void GL_APIENTRY glUniform1fv(GLint location, GLsizei count, const GLfloat *value) { HEADLESS_RECORD(count*sizeof(GLfloat)); }
+void GL_APIENTRY glUniform2fv(GLint location, GLsizei count, const GLfloat *value) { HEADLESS_RECORD(count*2*sizeof(GLfloat)); }
+void GL_APIENTRY glUniform3fv(GLint location, GLsizei count, const GLfloat *value) { HEADLESS_RECORD(count*3*sizeof(GLfloat)); }
+void GL_APIENTRY glUniform4fv(GLint location, GLsizei count, const GLfloat *value) { HEADLESS_RECORD(count*4*sizeof(GLfloat)); }
+void GL_APIENTRY glUniform1iv(GLint location, GLsizei count, const GLint *value) { HEADLESS_RECORD(count*sizeof(GLint)); }
+void GL_APIENTRY glUniform2iv(GLint location, GLsizei count, const GLint *value) { HEADLESS_RECORD(count*2*sizeof(GLint)); }
+void GL_APIENTRY glUniform3iv(GLint location, GLsizei count, const GLint *value) { HEADLESS_RECORD(count*3*sizeof(GLint)); }
+void GL_APIENTRY glUniform4iv(GLint location, GLsizei count, const GLint *value) { HEADLESS_RECORD(count*4*sizeof(GLint)); }
+void GL_APIENTRY glUniformMatrix4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) { HEADLESS_RECORD(count*16*sizeof(GLfloat)); }
+
+//----------------------------------------------------------------------------------
+// GL ES2 vertex attributes and drawing
+//----------------------------------------------------------------------------------
+void GL_APIENTRY glVertexAttribPointer(GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const void *pointer) { HEADLESS_RECORD(0); }
+void GL_APIENTRY glEnableVertexAttribArray(GLuint index) { HEADLESS_RECORD(0); }
+void GL_APIENTRY glDisableVertexAttribArray(GLuint index) { HEADLESS_RECORD(0); }
+void GL_APIENTRY glVertexAttrib2f(GLuint index, GLfloat x, GLfloat y) { HEADLESS_RECORD(2*sizeof(GLfloat)); }
+void GL_APIENTRY glVertexAttrib3f(GLuint index, GLfloat x, GLfloat y, GLfloat z) { HEADLESS_RECORD(3*sizeof(GLfloat)); }
+void GL_APIENTRY glVertexAttrib4f(GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w) { HEADLESS_RECORD(4*sizeof(GLfloat)); }
+void GL_APIENTRY glDrawArrays(GLenum mode, GLint first, GLsizei count) { HEADLESS_RECORD(0); }
+void GL_APIENTRY glDrawElements(GLenum mode, GLsizei count, GLenum type, const void *indices) { HEADLESS_RECORD(0); }
+
+//----------------------------------------------------------------------------------
+// GL ES2 state
+//----------------------------------------------------------------------------------
+void GL_APIENTRY glEnable(GLenum cap) { HEADLESS_RECORD(0); }
+void GL_APIENTRY glDisable(GLenum cap) { HEADLESS_RECORD(0); }
+void GL_APIENTRY glBlendFunc(GLenum sfactor, GLenum dfactor) { HEADLESS_RECORD(0); }
+void GL_APIENTRY glDepthFunc(GLenum func) { HEADLESS_RECORD(0); }
+void GL_APIENTRY glCullFace(GLenum mode) { HEADLESS_RECORD(0); }
+void GL_APIENTRY glFrontFace(GLenum mode) { HEADLESS_RECORD(0); }
+void GL_APIENTRY glHint(GLenum target, GLenum mode) { HEADLESS_RECORD(0); }
+void GL_APIENTRY glViewport(GLint x, GLint y, GLsizei width, GLsizei height) { HEADLESS_RECORD(0); }
+void GL_APIENTRY glScissor(GLint x, GLint y, GLsizei width, GLsizei height) { HEADLESS_RECORD(0); }
+void GL_APIENTRY glClearColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha) { HEADLESS_RECORD(0); }
+void GL_APIENTRY glClear(GLbitfield mask) { HEADLESS_RECORD(0); }
+void GL_APIENTRY glClearDepthf(GLfloat d) { HEADLESS_RECORD(0); }
@@ -0,0 +1,119 @@
+/*
+ * orbisGl2 host shims
+ * debugnet logs to stdout and orbisNfs maps to POSIX file I/O, so orbisGl2 can run on a host
+ * together with the headless backend (see orbisGl2headless.c).
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdarg.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <debugnet.h>
+#include <orbisNfs.h>
+
+static int debugNetLevel = INFO;
+
+//----------------------------------------------------------------------------------
+// debugnet
+//----------------------------------------------------------------------------------
+int debugNetInit(const char *serverIp, int port, int level)
+{
+	debugNetLevel = level;
+	return 1;
+}
+
+void debugNetFinish(void)
+{
+	fflush(stdout);
+}
+
+void debugNetSetLogLevel(int level)
+{
+	debugNetLevel = level;
+}
+
+void debugNetPrintf(int level, const char *format, ...)
+{
+	static const char *levels[] = { "NONE", "INFO", "ERROR", "DEBUG" };
+	if ((level > debugNetLevel) || (level < 0)) return;
+	va_list args;
+	va_start(args, format);
+	printf("[%s] ", levels[level]);
+	vprintf(format, args);
+	va_end(args);
+}
+
+//----------------------------------------------------------------------------------
+// orbisNfs
+//----------------------------------------------------------------------------------
+int orbisNfsInit(const char *url)
+{
+	return 0;
+}
+
+void orbisNfsFinish(void)
+{
+}
+
+int orbisNfsOpen(const char *file, int flags, int mode)
+{
+	return open(file, flags, mode);
+}
+
+int orbisNfsRead(int fd, void *data, int size)
+{
+	return (int)read(fd, data, size);
+}
+
+int orbisNfsWrite(int fd, const void *data, int size)
+{
+	return (int)write(fd, data, size);
+}
+
+int orbisNfsLseek(int fd, int offset, int whence)
+{
+	return (int)lseek(fd, offset, whence);
+}
+
+int orbisNfsClose(int fd)
+{
+	return close(fd);
+}
+
+int orbisNfsGetFileContentLength(const char *filename)
+{
+	struct stat st;
+	if (stat(filename, &st) != 0) return -1;
+	return (int)st.st_size;
+}
+
+unsigned char *orbisNfsGetFileContent(const char *filename)
+{
+	int size = orbisNfsGetFileContentLength(filename);
+	if (size < 0)
+	{
+		debugNetPrintf(ERROR, "[ORBISNFS] %s [%s] File not found\n",__FUNCTION__, filename);
+		return NULL;
+	}
+	int fd = open(filename, O_RDONLY);
+	if (fd < 0) return NULL;
+	// Extra zero byte so text files can be used as strings
+	unsigned char *content = (unsigned char *)malloc(size + 1);
+	int total = 0;
+	while ((content != NULL) && (total < size))
+	{
+		int count = (int)read(fd, content + total, size - total);
+		if (count <= 0) break;
+		total += count;
+	}
+	close(fd);
+	if ((content == NULL) || (total != size))
+	{
+		debugNetPrintf(ERROR, "[ORBISNFS] %s [%s] Read failed\n",__FUNCTION__, filename);
+		free(content);
+		return NULL;
+	}
+	content[size] = '\0';
+	return content;
+}
@@ -245,6 +245,8 @@ typedef struct Texture2D {
     int height;             // Texture base height
     int mipmaps;            // Mipmap levels, 1 by default
     int format;             // Data format (PixelFormat type)
+    int atlasEntry;         // Runtime atlas entry (index + 1), 0 if texture is not packed
+    unsigned int atlasGeneration;   // Runtime atlas entry generation, stale textures don't alias reused entries
 } Texture2D;
 
 // Texture type, same as Texture2D
@@ -274,6 +276,46 @@ typedef struct NPatchInfo {
     int type;              // layout of the n-patch: 3x3, 1x3 or 3x1
 } NPatchInfo;
 
+// Sprite instance, DrawTexturePro() parameters for DrawSprites()
+typedef struct SpriteInstance {
+    Rectangle sourceRec;   // Region in the texture
+    Rectangle destRec;     // Destination rectangle on screen
+    Vector2 origin;        // Rotation origin (relative to destRec)
+    float rotation;        // Rotation in degrees
+    Color tint;            // Tint color
+} SpriteInstance;
+
+// Runtime texture atlas packing stats
+#ifndef ATLAS_MAX_PAGES
+    #define ATLAS_MAX_PAGES          8      // Maximum number of runtime atlas pages
+#endif
+typedef struct TextureAtlasStats {
+    int pageSize;                       // Atlas page width and height
+    int pagesCount;                     // Atlas pages in use
+    int texturesCount;                  // Textures currently packed
+    int rejectedCount;                  // Textures loaded standalone (too big, not packable or atlas full)
+    float pageFill[ATLAS_MAX_PAGES];    // Area used by packed textures per page [0..1]
+    float fill;                         // Area used by packed textures over all pages [0..1]
+    int usedArea;                       // Pixels used by packed textures
+    int wastedArea;                     // Pixels not used by packed textures (free, padding and unloaded)
+} TextureAtlasStats;
+
+#if defined(ORBISGL_HEADLESS)
+// Headless backend recorded GL command
+typedef struct HeadlessCommand {
+    int id;                             // GL entry point id (see GetHeadlessCommandName())
+    unsigned int bytes;                 // Bytes passed to GL (buffer/texture data, uniforms, shader sources)
+} HeadlessCommand;
+
+// Headless backend command log
+typedef struct HeadlessLog {
+    HeadlessCommand *commands;          // Recorded commands in submission order
+    int commandsCount;                  // Recorded commands count
+    unsigned long long bytes;           // Recorded commands total bytes
+    int swaps;                          // eglSwapBuffers() calls (frames)
+} HeadlessLog;
+#endif
+
 // Font character info
 typedef struct CharInfo {
     int value;              // Character value (Unicode)
@@ -333,6 +375,8 @@ typedef struct Mesh {
     float *animNormals;     // Animated normals (after bones transformations)
     int *boneIds;           // Vertex bone ids, up to 4 bones influence by vertex (skinning)
     float *boneWeights;     // Vertex bone weight, up to 4 bones influence by vertex (skinning)
+    float *boneMatrices;    // Bone skinning matrices, 3 rows by bone (GPU skinning, set by UpdateModelAnimation())
+    int boneCount;          // Number of bone skinning matrices
 
     // OpenGL identifiers
     unsigned int vaoId;     // OpenGL Vertex Array Object id
@@ -345,6 +389,18 @@ typedef struct Shader {
     int *locs;              // Shader locations array (MAX_SHADER_LOCATIONS)
 } Shader;
 
+typedef struct ShaderVariantsUniforms ShaderVariantsUniforms;
+
+// Shader variants, same sources compiled once per features set (SHADER_FEATURE_*)
+// NOTE: Every variant is its own program, uniforms shared by variants are set with SetShaderVariantsValue()
+typedef struct ShaderVariants {
+    char *vsCode;           // Vertex shader code without feature defines
+    char *fsCode;           // Fragment shader code without feature defines
+    unsigned int features;  // Features enabled on every variant (i.e. SHADER_FEATURE_FOG)
+    Shader *programs;       // Variant programs by features key, compiled on first use (MAX_SHADER_VARIANTS)
+    ShaderVariantsUniforms *uniforms;   // Uniform values set on every variant, applied to variants compiled later
+} ShaderVariants;
+
 // Material texture map
 typedef struct MaterialMap {
     Texture2D texture;      // Material map texture
@@ -357,6 +413,7 @@ typedef struct Material {
     Shader shader;          // Material shader
     MaterialMap *maps;      // Material maps array (MAX_MATERIAL_MAPS)
     float *params;          // Material generic parameters (if required)
+    ShaderVariants variants;// Material shader variants (if programs set, used instead of shader)
 } Material;
 
 // Transformation properties
@@ -389,15 +446,44 @@ typedef struct Model {
     Transform *bindPose;    // Bones base transformation (pose)
 } Model;
 
+// Animation quantized channels (compact animation data, poses evaluated when sampled)
+// NOTE: Channel value is offset + quantized*scale, 10 channels by bone: translation, rotation and scale
+typedef struct AnimationChannels {
+    int frameChannels;          // Animated channels by frame
+    float *offsets;             // Channels offset by bone (10 floats by bone)
+    float *scales;              // Channels scale by bone (10 floats by bone)
+    unsigned int *masks;        // Animated channels mask by bone (channels not in mask keep offset)
+    unsigned short *frameData;  // Quantized animated channels of all frames (frameCount*frameChannels)
+} AnimationChannels;
+
 // Model animation
 typedef struct ModelAnimation {
     int boneCount;          // Number of bones
     BoneInfo *bones;        // Bones information (skeleton)
 
     int frameCount;         // Number of animation frames
-    Transform **framePoses; // Poses array by frame
+    Transform **framePoses; // Poses array by frame (NULL for compact animations)
+    AnimationChannels *channels; // Compact animation channels, one block (NULL for baked poses)
+    float frameRate;        // Animation frames per second (time based sampling)
 } ModelAnimation;
 
+// Animation pose, bones local transforms stored by component (SoA) for batched blending
+// NOTE: 10 arrays of boneCount floats in one block: translation x, y, z, rotation x, y, z, w, scale x, y, z,
+// followed by sampling and blending scratch components (3 poses), allocated with LoadAnimationPose()
+typedef struct AnimationPose {
+    int boneCount;          // Number of bones
+    float *components;      // Components arrays (components[c*boneCount + bone])
+    float *scratch;         // Sampling and blending scratch (next frame, layer sample and additive reference)
+} AnimationPose;
+
+// Animation blending layer
+typedef struct AnimationLayer {
+    ModelAnimation anim;    // Animation sampled
+    float time;             // Sampling time in seconds (adjacent frames interpolated)
+    float weight;           // Layer weight (normalized between non additive layers)
+    bool additive;          // Additive layer, its difference to first frame is added with weight
+} AnimationLayer;
+
 // Ray type (useful for raycast)
 typedef struct Ray {
     Vector3 position;       // Ray position (origin)
@@ -716,7 +802,10 @@ typedef enum {
     LOC_MAP_CUBEMAP,
     LOC_MAP_IRRADIANCE,
     LOC_MAP_PREFILTER,
-    LOC_MAP_BRDF
+    LOC_MAP_BRDF,
+    LOC_VERTEX_BONEIDS,
+    LOC_VERTEX_BONEWEIGHTS,
+    LOC_MATRIX_BONES
 } ShaderLocationIndex;
 
 #define LOC_MAP_DIFFUSE      LOC_MAP_ALBEDO
@@ -753,6 +842,15 @@ typedef enum {
 #define MAP_DIFFUSE      MAP_ALBEDO
 #define MAP_SPECULAR     MAP_METALNESS
 
+// Shader variant features, every feature defines a macro on variant sources
+typedef enum {
+    SHADER_FEATURE_VERTEX_COLOR = 1,    // USE_VERTEX_COLOR: mesh provides vertex colors
+    SHADER_FEATURE_NORMAL_MAP = 2,      // USE_NORMAL_MAP: material normal map and mesh tangents
+    SHADER_FEATURE_SPECULAR_MAP = 4,    // USE_SPECULAR_MAP: material specular map
+    SHADER_FEATURE_SKINNING = 8,        // USE_SKINNING: vertex skinning on shader (position and normal, boneMatrices uniform)
+    SHADER_FEATURE_FOG = 16             // USE_FOG: fog (enabled with ShaderVariants.features)
+} ShaderFeature;
+
 // Pixel formats
 // NOTE: Support depends on OpenGL version and platform
 typedef enum {
@@ -866,13 +964,19 @@ typedef enum {
 
 //rlgl
 #ifndef MAX_BATCH_BUFFERING
-    #define MAX_BATCH_BUFFERING              1      // Max number of buffers for batching (multi-buffering)
+    #define MAX_BATCH_BUFFERING              3      // Max number of buffers for batching (multi-buffering ring)
 #endif
 
-#define MAX_BATCH_ELEMENTS            	2048
+#define MAX_BATCH_ELEMENTS            	2048      // Default batch capacity in quads (see rlSetBatchCapacity())
+#ifndef MAX_BATCH_ELEMENTS_GROWTH
+    #define MAX_BATCH_ELEMENTS_GROWTH    65536      // Max batch capacity reachable by the growth policy
+#endif
 
 #define MAX_MATRIX_STACK_SIZE               32      // Max size of Matrix stack
-#define MAX_DRAWCALL_REGISTERED            256      // Max draws by state changes (mode, texture)
+#define MAX_DRAWCALL_REGISTERED            256      // Default max draws by state changes (mode, texture)
+#ifndef MAX_DRAWCALL_GROWTH
+    #define MAX_DRAWCALL_GROWTH           4096      // Max draws registry size reachable by the growth policy
+#endif
 
 #ifndef DEFAULT_NEAR_CULL_DISTANCE
     #define DEFAULT_NEAR_CULL_DISTANCE    0.01      // Default near cull distance
@@ -887,6 +991,9 @@ typedef enum {
 // Shader and material limits
 #define MAX_SHADER_LOCATIONS                32      // Maximum number of predefined locations stored in shader struct
 #define MAX_MATERIAL_MAPS                   12      // Maximum number of texture maps stored in shader struct
+#define MAX_SHADER_VARIANTS                 32      // Maximum number of shader variants (all SHADER_FEATURE_* permutations)
+#define MAX_MESH_VBO                         9      // Maximum number of vbo per mesh
+#define MAX_SKINNING_BONES                  40      // Maximum number of bones skinned on GPU (3 vertex uniform vectors by bone)
 
 // Texture parameters (equivalent to OpenGL defines)
 #define RL_TEXTURE_WRAP_S               0x2802      // GL_TEXTURE_WRAP_S
@@ -1106,38 +1213,93 @@ typedef struct Vertex {
 #define DEFAULT_ATTRIB_COLOR_NAME       "vertexColor"       // shader-location = 3
 #define DEFAULT_ATTRIB_TANGENT_NAME     "vertexTangent"     // shader-location = 4
 #define DEFAULT_ATTRIB_TEXCOORD2_NAME   "vertexTexCoord2"   // shader-location = 5
+#define DEFAULT_ATTRIB_BONEIDS_NAME     "vertexBoneIds"     // shader-location = 6
+#define DEFAULT_ATTRIB_BONEWEIGHTS_NAME "vertexBoneWeights" // shader-location = 7
 
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
 
-// Dynamic vertex buffers (position + texcoords + colors + indices arrays)
+// Batch vertex (interleaved position + texcoord + color, 24 bytes)
+typedef struct BatchVertex {
+    float position[3];          // vertex position (XYZ) (shader-location = 0)
+    float texcoord[2];          // vertex texture coordinates (UV) (shader-location = 1)
+    unsigned char color[4];     // vertex color (RGBA) (shader-location = 3)
+} BatchVertex;
+
+// Dynamic vertex buffers (interleaved vertex array + indices array)
 typedef struct DynamicBuffer {
     int vCounter;               // vertex position counter to process (and draw) from full buffer
     int tcCounter;              // vertex texcoord counter to process (and draw) from full buffer
     int cCounter;               // vertex color counter to process (and draw) from full buffer
 
-    float *vertices;            // vertex position (XYZ - 3 components per vertex) (shader-location = 0)
-    float *texcoords;           // vertex texture coordinates (UV - 2 components per vertex) (shader-location = 1)
-    unsigned char *colors;      // vertex colors (RGBA - 4 components per vertex) (shader-location = 3)
-    unsigned short *indices;    // vertex indices (in case vertex data comes indexed) (6 indices per quad)
+    BatchVertex *vertices;      // interleaved vertex data (position, texcoord, color)
+    void *indices;              // vertex indices (unsigned short or unsigned int, see indexType) (6 indices per quad)
     unsigned int vaoId;         // OpenGL Vertex Array Object id
-    unsigned int vboId[4];      // OpenGL Vertex Buffer Objects id (4 types of vertex data)
+    unsigned int vboId[2];      // OpenGL Vertex Buffer Objects id (interleaved vertex data, indices)
+    bool inFlight;              // Buffer drawn in current frame (GPU could still be reading it)
 } DynamicBuffer;
 
+// Deferred transform for a batch vertex range (applied at flush)
+typedef struct TransformSpan {
+    int firstVertex;            // First vertex of the range on current buffer
+    int vertexCount;            // Number of vertex of the range
+    Matrix transform;           // Transform to apply to the range (rlPushMatrix() state)
+} TransformSpan;
+
 // Draw call type
 typedef struct DrawCall {
     int mode;                   // Drawing mode: LINES, TRIANGLES, QUADS
     int vertexCount;            // Number of vertex of the draw
     int vertexAlignment;        // Number of vertex required for index alignment (LINES, TRIANGLES)
     //unsigned int vaoId;         // Vertex array id to be used on the draw
-    //unsigned int shaderId;      // Shader id to be used on the draw
+    Shader shader;              // Shader to be used on the draw
+    int blendMode;              // Blend mode to be used on the draw
     unsigned int textureId;     // Texture id to be used on the draw
 
     //Matrix projection;        // Projection matrix for this draw
     //Matrix modelview;         // Modelview matrix for this draw
 } DrawCall;
 
+// Batch flush causes (rlglDraw() with vertex data to draw)
+typedef enum {
+    FLUSH_EXPLICIT = 0,         // rlglDraw() called directly (EndDrawing(), user code)
+    FLUSH_BUFFER_FULL,          // Vertex buffer full on rlEnd()/rlVertex*()/rlDisableTexture()
+    FLUSH_BUFFER_LIMIT,         // rlCheckBufferLimit() overflow
+    FLUSH_DRAW_LIMIT,           // Draw calls registry full (maxDrawCalls)
+    FLUSH_STATE_CHANGE,         // Texture/mode change alignment, render texture, scissor, non batched drawing
+    FLUSH_MODE_CHANGE           // BeginMode2D()/EndMode2D()/BeginMode3D()/EndMode3D()
+} FlushCause;
+
+#define MAX_FLUSH_CAUSES         6      // Number of FlushCause values
+
+// Rendering stats of a frame (see rlGetFrameStats())
+typedef struct FrameStats {
+    int drawCalls;              // GL draw calls (batch, meshes, display lists)
+    int flushes;                // Batch flushes
+    int flushesByCause[MAX_FLUSH_CAUSES];   // Batch flushes by cause (FlushCause)
+    int vertexCount;            // Vertex submitted through the batch
+    int bytesUploaded;          // Bytes uploaded with glBufferSubData()
+    int textureBinds;           // Texture binds issued (not elided by state cache)
+    int meshDraws;              // rlDrawMesh() calls
+    int stateCallsElided;       // Redundant GL state calls skipped by state cache
+    int uniformUploadsSkipped;  // Uniform uploads skipped (value already set on program)
+    int unorderedDrawsIn;       // Draws submitted inside unordered regions (before merging)
+    int unorderedDrawsOut;      // Draws left after merging unordered regions
+} FrameStats;
+
+// Display list type, static vertex data recorded from rl* vertex submissions
+// NOTE: Quads are stored as triangles, draws are replayed in recording order
+// NOTE: Shader locations are copied, but shader programs used while recording must stay loaded to draw the list
+typedef struct DisplayList {
+    int vertexCount;            // Number of vertex stored on GPU
+    int drawsCount;             // Number of draws
+    DrawCall *draws;            // Draws to replay (mode, vertexCount, shader, blend mode, texture)
+    int *locs;                  // Shader locations of draws, one copy per shader (draws shader.locs point here)
+    unsigned int vaoId;         // OpenGL Vertex Array Object id
+    unsigned int vboId;         // OpenGL Vertex Buffer Object id (interleaved vertex data)
+} DisplayList;
+
 #if defined(SUPPORT_VR_SIMULATOR)
 // VR Stereo rendering configuration for simulator
 typedef struct VrStereoConfig {
@@ -1157,13 +1319,48 @@ typedef struct rlglData {
         Matrix projection;                  // Default projection matrix
         Matrix transform;                   // Transform matrix to be used with rlTranslate, rlRotate, rlScale
         bool doTransform;                   // Use transform matrix against vertex (if required)
+        bool transformDirty;                // Transform state changed since last vertex (new span required)
+        Matrix viewProjection;              // Cached modelview*projection (batch vertex come transformed)
+        Matrix meshViewProjection;          // Cached transform*modelview*projection (meshes and display lists)
+        bool viewProjectionDirty;           // Modelview or projection changed since viewProjection computed
+        bool meshViewProjectionDirty;       // Any matrix changed since meshViewProjection computed
+        bool transformSpanActive;           // Last transform span still receiving vertex
+        TransformSpan *transformSpans;      // Deferred transforms for current buffer vertex ranges
+        int transformSpansCounter;          // Deferred transforms counter
         Matrix stack[MAX_MATRIX_STACK_SIZE];// Matrix stack for push/pop
         int stackCounter;                   // Matrix stack counter
 
         DynamicBuffer vertexData[MAX_BATCH_BUFFERING];// Default dynamic buffer for elements data
         int currentBuffer;                  // Current buffer tracking, multi-buffering system is supported
+        unsigned int ringWrapsInFlight;     // Times the ring reused a buffer still in flight (orphaned on upload)
         DrawCall *draws;                    // Draw calls array
         int drawsCounter;                   // Draw calls counter
+        int batchElements;                  // Batch capacity in quads (4 vertex each)
+        int maxDrawCalls;                   // Draw calls registry size
+        unsigned int indexType;             // Batch index type: GL_UNSIGNED_SHORT or GL_UNSIGNED_INT (more than 65536 vertex)
+        bool batchGrowth;                   // Grow batch between frames from previous frame usage
+        int runVertexCount;                 // Vertex flushed since last flush not caused by batch capacity
+        int runDrawCount;                   // Draw calls flushed since last flush not caused by batch capacity
+        int peakVertexCount;                // Largest vertex run on current frame (single flush with enough capacity)
+        int peakDrawCount;                  // Largest draw calls run on current frame
+        int flushCause;                     // Cause of next batch flush (FlushCause), reset on rlglDraw()
+        unsigned char flushColor[4];        // Last vertex color before a buffer full flush (vertex without color on new buffer take it)
+        bool gpuSkinning;                   // Animated meshes skinned on GPU (UpdateModelAnimation() only sets bone matrices)
+        FrameStats frameStats;              // Rendering stats of current frame
+        FrameStats lastFrameStats;          // Rendering stats of last frame
+        int batchLimitFlushes;              // Flushes forced by batch capacity on current frame
+        int drawLimitFlushes;               // Flushes forced by draw calls registry size on current frame
+        bool unorderedRegion;               // Draws inside an order independent region (merged by texture and mode)
+        int unorderedFirstDraw;             // First draw registry entry of the unordered region
+        BatchVertex *sortVertices;          // Scratch vertex array used to merge unordered regions
+        DrawCall *sortDraws;                // Scratch draws array used to merge unordered regions
+        bool listRecording;                 // Batch vertex data captured into a display list instead of drawn
+        BatchVertex *listVertices;          // Display list vertex data being recorded
+        int listVertexCount;                // Display list vertex counter
+        int listVertexCapacity;             // Display list vertex array size
+        DrawCall *listDraws;                // Display list draws being recorded
+        int listDrawsCount;                 // Display list draws counter
+        int listDrawsCapacity;              // Display list draws array size
 
         Texture2D shapesTexture;            // Texture used on shapes drawing (usually a white)
         Rectangle shapesTextureRec;         // Texture source rectangle used on shapes drawing
@@ -1172,12 +1369,33 @@ typedef struct rlglData {
         unsigned int defaultFShaderId;      // Default fragment shader Id (used by default shader program)
         Shader defaultShader;               // Basic shader, support vertex color and diffuse texture
         Shader currentShader;               // Shader to be used on rendering (by default, defaultShader)
+        int currentBlendMode;               // Blending mode to be used on rendering (by default, BLEND_ALPHA)
         float currentDepth;                 // Current depth value
 
         int framebufferWidth;               // Default framebuffer width
         int framebufferHeight;              // Default framebuffer height
 
     } State;
+    struct {
+        unsigned int program;               // Shader program in use
+        unsigned int activeUnit;            // Active texture unit (0 based)
+        unsigned int texture2D[MAX_MATERIAL_MAPS];      // GL_TEXTURE_2D bound per texture unit
+        unsigned int textureCube[MAX_MATERIAL_MAPS];    // GL_TEXTURE_CUBE_MAP bound per texture unit
+        unsigned int arrayBuffer;           // GL_ARRAY_BUFFER bound
+        unsigned int elementBuffer;         // GL_ELEMENT_ARRAY_BUFFER bound (part of VAO state)
+        unsigned int vao;                   // Vertex array object bound
+        unsigned int blendSrc;              // Blend function source factor
+        unsigned int blendDst;              // Blend function destination factor
+        int depthTest;                      // GL_DEPTH_TEST enabled (1), disabled (0) or unknown (-1)
+        int cullFace;                       // GL_CULL_FACE enabled (1), disabled (0) or unknown (-1)
+        int scissorTest;                    // GL_SCISSOR_TEST enabled (1), disabled (0) or unknown (-1)
+        int elidedCalls;                    // Redundant GL calls skipped on current frame
+        int lastFrameElidedCalls;           // Redundant GL calls skipped on last frame
+        int textureBinds;                   // Texture binds issued on current frame
+        int lastFrameTextureBinds;          // Texture binds issued on last frame
+        int uniformsSkipped;                // Uniform uploads skipped on current frame
+        int lastFrameUniformsSkipped;       // Uniform uploads skipped on last frame
+    } Cache;            // Shadow of GL state, used to skip redundant GL calls
     struct {
         bool vao;                           // VAO support (OpenGL ES2 could not support VAO extension)
         bool texNPOT;                       // NPOT textures full support
@@ -1191,6 +1409,8 @@ typedef struct rlglData {
         bool texMirrorClamp;                // Clamp mirror wrap mode supported
         bool texAnisoFilter;                // Anisotropic texture filtering support
         bool debugMarker;                   // Debug marker support
+        bool elementIndexUint;              // 32 bit element indices support (GL_OES_element_index_uint)
+        bool programBinary;                 // Program binary get/load support (GL_OES_get_program_binary)
 
         float maxAnisotropicLevel;          // Maximum anisotropy level supported (minimum is 2.0f)
         int maxDepthBits;                   // Maximum bits for depth component
@@ -1206,9 +1426,12 @@ typedef struct rlglData {
 #endif  // SUPPORT_VR_SIMULATOR
 } rlglData;
 
-static PFNGLGENVERTEXARRAYSOESPROC glGenVertexArrays;        // Entry point pointer to function glGenVertexArrays()
-static PFNGLBINDVERTEXARRAYOESPROC glBindVertexArray;        // Entry point pointer to function glBindVertexArray()
-static PFNGLDELETEVERTEXARRAYSOESPROC glDeleteVertexArrays;  // Entry point pointer to function glDeleteVertexArrays()
+// NOTE: Shared by all modules, loaded once on init (defined in core)
+extern PFNGLGENVERTEXARRAYSOESPROC glGenVertexArrays;        // Entry point pointer to function glGenVertexArrays()
+extern PFNGLBINDVERTEXARRAYOESPROC glBindVertexArray;        // Entry point pointer to function glBindVertexArray()
+extern PFNGLDELETEVERTEXARRAYSOESPROC glDeleteVertexArrays;  // Entry point pointer to function glDeleteVertexArrays()
+extern PFNGLGETPROGRAMBINARYOESPROC glGetProgramBinary;      // Entry point pointer to function glGetProgramBinary()
+extern PFNGLPROGRAMBINARYOESPROC glProgramBinary;            // Entry point pointer to function glProgramBinary()
 
 
 typedef struct OrbisGlConfig
@@ -1260,6 +1483,7 @@ void orbisGlDestroyDisplay();
 void orbisGlDestroySurface();
 void orbisGlDestroyContext();
 void orbisGlSwapBuffers();
+void orbisGlMakeCurrent(bool current);
 void SwapBuffers();
 void orbisGlShaderLog(GLuint shader_id);
 void orbisGlProgramLog(GLuint program_id);
@@ -1341,6 +1565,22 @@ int GetFPS(void);                                           // Returns current F
 float GetFrameTime(void);                                   // Returns time in seconds for last frame drawn
 double GetTime(void);                                       // Returns elapsed time in seconds since InitWindow()
 
+// Profiling functions
+// NOTE: Scope names and markers are not copied, they must be static strings (or outlive ExportProfileTrace())
+void SetProfilerEnabled(bool enabled);                      // Enable/disable CPU timing scopes recording (disabled by default)
+void BeginProfileScope(const char *name);                   // Begin CPU timing scope on calling thread
+void EndProfileScope(void);                                 // End last CPU timing scope begun on calling thread
+void AddProfileMarker(const char *name);                    // Add instant marker on calling thread timeline
+bool ExportProfileTrace(const char *fileName);              // Write recorded scopes as Chrome trace_event JSON (chrome://tracing)
+
+#if defined(ORBISGL_HEADLESS)
+// Headless backend functions (host build, GL ES2 calls are recorded instead of executed)
+HeadlessLog GetHeadlessLog(void);                           // Get GL commands recorded since last reset
+const char *GetHeadlessCommandName(int id);                 // Get GL entry point name of a recorded command
+void ResetHeadlessLog(void);                                // Clear recorded GL commands
+void PrintHeadlessLog(void);                                // Log recorded GL commands count and bytes per entry point
+#endif
+
 // Color-related functions
 int ColorToInt(Color color);                                // Returns hexadecimal value for a Color
 Vector4 ColorNormalize(Color color);                        // Returns color normalized as float [0..1]
@@ -1602,6 +1842,18 @@ void DrawTextureRec(Texture2D texture, Rectangle sourceRec, Vector2 position, Co
 void DrawTextureQuad(Texture2D texture, Vector2 tiling, Vector2 offset, Rectangle quad, Color tint);  // Draw texture quad with tiling and offset parameters
 void DrawTexturePro(Texture2D texture, Rectangle sourceRec, Rectangle destRec, Vector2 origin, float rotation, Color tint);       // Draw a part of a texture defined by a rectangle with 'pro' parameters
 void DrawTextureNPatch(Texture2D texture, NPatchInfo nPatchInfo, Rectangle destRec, Vector2 origin, float rotation, Color tint);  // Draws a texture (or part of it) that stretches or shrinks nicely
+void DrawSprites(Texture2D texture, const SpriteInstance *sprites, int count);                      // Draw multiple sprites from the same texture
+
+// Runtime texture atlas functions
+// NOTE: Packed textures share the atlas page GL texture, filter/wrap settings apply to the whole page.
+// Only 2D texture drawing (DrawTexture*(), DrawSprites(), DrawTextureNPatch()) remaps packed regions,
+// textures used on models, billboards, cubes or tiled quads must be loaded with LoadTextureFromImage()
+// Regions of unloaded textures are reused whole by textures fitting on them, pages are never shrunk or freed
+// before CloseTextureAtlas(), so mixed texture sizes can leave wasted area (see GetTextureAtlasStats())
+void InitTextureAtlas(int pageSize, int maxTextureSize);                                           // Enable runtime atlas pages for LoadTextureAtlasFromImage()
+void CloseTextureAtlas(void);                                                                      // Unload runtime atlas pages (packed textures become invalid)
+Texture2D LoadTextureAtlasFromImage(Image image);                                                  // Load texture packed into runtime atlas (standalone if atlas disabled or it doesn't fit)
+TextureAtlasStats GetTextureAtlasStats(void);                                                      // Get runtime atlas packing stats
 
 // Image/Texture misc functions
 int GetPixelDataSize(int width, int height, int format);                                           // Get pixel data size in bytes (image or texture)
@@ -1707,7 +1959,17 @@ void SetModelMeshMaterial(Model *model, int meshId, int materialId);
 
 // Model animations loading/unloading functions
 ModelAnimation *LoadModelAnimations(const char *fileName, int *animsCount);                       // Load model animations from file
+ModelAnimation *LoadModelAnimationsCompact(const char *fileName, int *animsCount);                // Load model animations from file keeping quantized channels
+void GetModelAnimationPose(ModelAnimation anim, int frame, Transform *pose);                      // Get model animation frame pose (bones global transforms)
+void UpdateModelAnimationTime(Model model, ModelAnimation anim, float time);                      // Update model animation pose at time in seconds (frames interpolated)
+AnimationPose LoadAnimationPose(int boneCount);                                                   // Load animation pose for blending (bones local transforms)
+void UnloadAnimationPose(AnimationPose pose);                                                     // Unload animation pose
+bool SampleModelAnimation(ModelAnimation anim, float time, AnimationPose pose);                   // Sample animation local pose at time in seconds (frames interpolated), false if not sampled
+void BlendModelAnimations(const AnimationLayer *layers, int count, AnimationPose pose);           // Blend animation layers into pose (crossfades and additive layers)
+void UpdateModelAnimationPoses(Model *models, AnimationPose *poses, int count);                   // Update several models animated vertex data from blended poses
 void UpdateModelAnimation(Model model, ModelAnimation anim, int frame);                           // Update model animation pose
+void UpdateModelAnimations(Model *models, ModelAnimation *anims, int *frames, int count);          // Update several models animation pose (skinned on animation workers)
+void SetAnimationWorkers(int count);                                                              // Set animation worker threads (0 skins on calling thread only)
 void UnloadModelAnimation(ModelAnimation anim);                                                   // Unload animation data
 bool IsModelAnimationValid(Model model, ModelAnimation anim);                                     // Check model animation skeleton match
 
@@ -1757,6 +2019,13 @@ RayHitInfo GetCollisionRayGround(Ray ray, float groundHeight);
 Shader LoadShader(const char *vsFileName, const char *fsFileName);  // Load shader from files and bind default locations
 Shader LoadShaderCode(const char *vsCode, const char *fsCode);      // Load shader from code strings and bind default locations
 void UnloadShader(Shader shader);                                   // Unload shader from GPU memory (VRAM)
+void SetShaderCacheDirectory(const char *path);                     // Set directory for program binaries cache (NULL disables cache)
+ShaderVariants LoadShaderVariants(const char *vsFileName, const char *fsFileName);  // Load shader files to compile features variants from
+ShaderVariants LoadShaderVariantsCode(const char *vsCode, const char *fsCode);      // Load shader code strings to compile features variants from
+Shader GetShaderVariant(ShaderVariants variants, unsigned int features);            // Get variant for a features set (compiled on first use)
+unsigned int GetMeshShaderFeatures(Mesh mesh, Material material);                   // Get variant features required to draw a mesh with a material
+void SetShaderVariantsValue(ShaderVariants variants, const char *uniformName, const void *value, int uniformType, int count);  // Set uniform value on every variant (compiled and compiled later)
+void UnloadShaderVariants(ShaderVariants variants);                                 // Unload shader variants code and compiled programs
 
 Shader GetShaderDefault(void);                                      // Get default shader
 Texture2D GetTextureDefault(void);                                  // Get default texture
@@ -1898,6 +2167,8 @@ void rlNormal3f(float x, float y, float z);     // Define one vertex (normal) -
 void rlColor4ub(byte r, byte g, byte b, byte a);    // Define one vertex (color) - 4 byte
 void rlColor3f(float x, float y, float z);          // Define one vertex (color) - 3 float
 void rlColor4f(float x, float y, float z, float w); // Define one vertex (color) - 4 float
+void rlVertexArray(const float *positions, const float *texcoords, const unsigned char *colors, int count);  // Define multiple vertex (XYZ, UV and RGBA arrays, texcoords/colors optional)
+void rlPushQuads(const BatchVertex *vertices, int quadCount);   // Push packed quads (4 vertex each) using current texture
 
 //------------------------------------------------------------------------------------
 // Functions Declaration - OpenGL equivalent functions (common to 1.1, 3.3+, ES2)
@@ -1931,11 +2202,36 @@ unsigned int rlLoadAttribBuffer(unsigned int vaoId, int shaderLoc, void *buffer,
 // Functions Declaration - rlgl functionality
 //------------------------------------------------------------------------------------
 void rlglInit(int width, int height);           // Initialize rlgl (buffers, shaders, textures, states)
+void rlglInitEx(int width, int height, int batchElements, int maxDrawCalls);  // Initialize rlgl with custom batch capacity
 void rlglClose(void);                           // De-inititialize rlgl (buffers, shaders, textures)
 void rlglDraw(void);                            // Update and draw default internal buffers
+void rlglEndFrame(void);                        // Retire batch buffers after buffer swap
+unsigned int rlGetBatchRingWraps(void);         // Get batch ring wraps onto in-flight buffers
 
 int rlGetVersion(void);                         // Returns current OpenGL version
 bool rlCheckBufferLimit(int vCount);            // Check internal buffer overflow for a given number of vertex
+void rlSetBatchCapacity(int batchElements, int maxDrawCalls);  // Set (and reload) default batch capacity
+void rlSetBatchGrowth(bool enabled);            // Enable batch growth between frames from previous frame peak flush size
+void rlBeginUnorderedRegion(void);              // Begin order independent region (draws merged by texture and mode)
+void rlEndUnorderedRegion(void);                // End order independent region
+void rlGetUnorderedStats(unsigned int *drawsIn, unsigned int *drawsOut);  // Get draws before/after unordered regions merging on last frame
+void rlResetStateCache(void);                   // Invalidate GL state cache (required after direct GL state changes)
+int rlGetStateCallsElided(void);                // Get redundant GL state calls skipped on last frame
+FrameStats rlGetFrameStats(void);               // Get rendering stats of last frame (draws, flushes by cause, uploads...)
+void rlBeginList(void);                         // Begin recording rl* vertex submissions into a display list
+DisplayList rlEndList(void);                    // End recording and upload display list to GPU (static)
+void rlDrawList(DisplayList list, Matrix transform);  // Draw display list with an additional transform
+void rlUnloadList(DisplayList list);            // Unload display list from GPU and CPU
+void rlEnableRenderThread(void);                // Enable render thread (GL submission decoupled from game thread)
+void rlDisableRenderThread(void);               // Disable render thread (EGL context back to calling thread)
+bool rlIsRenderThreadEnabled(void);             // Check if render thread is enabled
+void rlBeginThreadBatch(int key);               // Begin recording calling thread rl* vertex submissions into a thread batch
+void rlEndThreadBatch(void);                    // End thread batch, merged in key order by EndDrawing() or rlMergeThreadBatches()
+void rlMergeThreadBatches(void);                // Merge ended thread batches into default batch at this point of the frame
+void rlEnableGpuSkinning(void);                 // Enable GPU skinning of animated meshes (bone matrices uploaded instead of vertex)
+void rlDisableGpuSkinning(void);                // Disable GPU skinning (animated meshes skinned on CPU)
+bool rlIsGpuSkinningEnabled(void);              // Check if GPU skinning is enabled
+bool rlCheckGpuSkinning(Mesh mesh, Material material);  // Check if mesh drawn with material can be skinned on GPU (bone buffers and shader support)
 void rlSetDebugMarker(const char *text);        // Set debug marker for analysis
 void rlLoadExtensions(void *loader);            // Load OpenGL extensions
 Vector3 rlUnproject(Vector3 source, Matrix proj, Matrix view);  // Get world coordinates from screen coordinates
@@ -1946,6 +2242,7 @@ unsigned int rlLoadTexture(void *data, int width, int height, int format, int mi
 unsigned int rlLoadTextureDepth(int width, int height, int bits, bool useRenderBuffer);     // Load depth texture/renderbuffer (to be attached to fbo)
 unsigned int rlLoadTextureCubemap(void *data, int size, int format);                        // Load texture cubemap
 void rlUpdateTexture(unsigned int id, int width, int height, int format, const void *data); // Update GPU texture with new data
+void rlUpdateTextureRec(unsigned int id, int offsetX, int offsetY, int width, int height, int format, const void *data); // Update GPU texture rectangle with new data
 void rlGetGlTextureFormats(int format, unsigned int *glInternalFormat, unsigned int *glFormat, unsigned int *glType);  // Get OpenGL internal formats
 void rlUnloadTexture(unsigned int id);                              // Unload texture from GPU memory
 
@@ -1984,8 +2281,42 @@ void SetShaderDefaultLocations(Shader *shader); // Bind default shader locations
 void UnloadShaderDefault(void);      // Unload default shader
 
 void LoadBuffersDefault(void);       // Load default internal buffers
+void SetBufferAttribsDefault(void);  // Set strided vertex attribs for the bound interleaved buffer
+void SetBlendModeDefault(int mode);  // Set GL blend function for a blending mode
+void UseProgramCached(unsigned int id);                          // glUseProgram() skipped if program already in use
+void ActiveTextureCached(unsigned int unit);                     // glActiveTexture() skipped if unit already active
+void BindTextureCached(unsigned int target, unsigned int id);    // glBindTexture() skipped if already bound on active unit
+void BindBufferCached(unsigned int target, unsigned int id);     // glBindBuffer() skipped if already bound
+void BindVertexArrayCached(unsigned int id);                     // glBindVertexArray() skipped if already bound
+void BlendFuncCached(unsigned int src, unsigned int dst);        // glBlendFunc() skipped if factors already set
+void SetCapabilityCached(unsigned int cap, bool enabled);        // glEnable()/glDisable() skipped if already in that state
+void ForgetObjectCached(unsigned int target, unsigned int id);   // Drop a deleted object from the state cache
+void SetUniformCached(unsigned int program, int uniformLoc, int uniformType, const void *value, int count);  // Upload uniform skipped if value already set
+bool FindUniformLocationCached(unsigned int program, const char *name, int *location);  // Find cached uniform location by name
+void AddUniformLocationCached(unsigned int program, const char *name, int location);    // Cache uniform location by name
+void ForgetUniformsCached(unsigned int program);                 // Drop a deleted program uniforms from the cache
+void ResetUniformsCached(void);                                  // Drop cached uniform values (set directly with GL)
+void UnloadUniformsCached(void);                                 // Unload uniform cache tables
+unsigned int LoadProgramBinaryCached(const char *vsCode, const char *fsCode);  // Load program binary from cache directory, returns 0 on miss
+void SaveProgramBinaryCached(unsigned int program, const char *vsCode, const char *fsCode);  // Save linked program binary to cache directory
 void UpdateBuffersDefault(void);     // Update default internal buffers (VAOs/VBOs) with vertex data
 void DrawBuffersDefault(void);       // Draw default internal buffers vertex data
+void UploadBatchDefault(DynamicBuffer *buffer, const BatchVertex *vertices, int vCounter);     // Upload batch vertex data to buffer VBO
+int DrawBatchDefault(DynamicBuffer *buffer, const DrawCall *draws, int drawsCount, Matrix matMVP, int currentBlendMode, unsigned int indexType);  // Draw batch, returns draw calls issued
+void ResetBuffersDefault(void);      // Reset default buffers counters and move to next buffer
+void DrawMeshDefault(Mesh mesh, Material material, Matrix matModel, Matrix matView, Matrix matProjection, Matrix matMVP);  // Draw mesh with provided matrices
+int DrawListDefault(unsigned int vaoId, unsigned int vboId, const DrawCall *draws, int drawsCount, Matrix matMVP, int currentBlendMode);  // Draw display list buffers, returns draw calls issued
+bool RenderThreadRecording(void);    // Check if GL work must be recorded for render thread
+void RenderThreadAcquireContext(void);  // Make EGL context current on game thread for immediate GL work
+void RenderThreadSubmitFrame(void);  // Record buffers swap and submit frame to render thread
+void RenderThreadRecordBatch(void);  // Record current default buffer for render thread
+void RenderThreadRecordMesh(Mesh mesh, Material material, Matrix matModel, Matrix matView, Matrix matProjection, Matrix matMVP);  // Record mesh draw
+void RenderThreadRecordList(DisplayList list, Matrix matMVP);  // Record display list draw
+float GetBatchDepth(void);           // Get depth for next 2d vertex of calling thread batch
+void FlushBuffersDefault(void);      // Flush full default buffers carrying the unfinished primitive over
+void TransformBuffersDefault(void);  // Apply deferred vertex transforms on current buffer (SIMD)
+void SortBuffersDefault(void);       // Merge unordered region draws by texture and mode
+void RecordBuffersDefault(void);     // Append current buffer vertex data to the display list being recorded
 void UnloadBuffersDefault(void);     // Unload default internal buffers vertex data from CPU and GPU
 
 void GenDrawCube(void);              // Generate and draw cube
@@ -2007,6 +2338,8 @@ void SwapBuffers(void);                          // Copy back buffer to front bu
 void InitTimer(void);                            // Initialize timer
 void Wait(float ms);                             // Wait for some milliseconds (stop program execution)
 
+void UnloadAnimationWorkers(void);               // Stop animation worker threads (module: models)
+
 //int GetGamepadButton(int button);                // Get gamepad button generic to all platforms
 //int GetGamepadAxis(int axis);                    // Get gamepad axis generic to all platforms
 //void PollInputEvents(void);                      // Register user events
@@ -3,6 +3,7 @@
  * Copyright (C) 2015,2016,2017,2018 Antonio Jose Ramos Marquez (aka bigboss) @psxdev on twitter
  * Repository https://github.com/orbisdev
  */
+#include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include <debugnet.h>
@@ -11,8 +12,36 @@
 #include <orbisNfs.h>
 #include <fcntl.h>
 
+#define PROFILER_RING_SIZE      16384   // Profiler events kept per thread (older ones are overwritten)
+#define PROFILER_MAX_THREADS        8   // Maximum number of threads recording profiler events
+#define PROFILER_NAME_LENGTH      128   // Maximum scope or marker name length exported to trace
+#define PROFILER_NO_RING  ((ProfilerRing *)-1)  // Thread ring could not be assigned, its events are discarded
+
+// Profiler event, begin/end of a scope or instant marker
+typedef struct ProfilerEvent {
+	const char *name;                   // Scope or marker name (not copied)
+	unsigned long long int time;        // Monotonic clock time in nanoseconds
+	char phase;                         // Chrome trace phase: 'B' begin, 'E' end, 'i' instant
+} ProfilerEvent;
+
+// Profiler per thread ring buffer, written only by its owner thread
+typedef struct ProfilerRing {
+	ProfilerEvent events[PROFILER_RING_SIZE];
+	unsigned int head;                  // Events written (published with release store)
+	int tid;                            // Thread index on trace
+} ProfilerRing;
+
+static volatile bool profilerEnabled = false;
+static ProfilerRing *profilerRings[PROFILER_MAX_THREADS] = { 0 };
+static int profilerRingsCount = 0;
+static __thread ProfilerRing *profilerRing = NULL;
 
 rlglData RLGL = { 0 };
+PFNGLGENVERTEXARRAYSOESPROC glGenVertexArrays = NULL;
+PFNGLBINDVERTEXARRAYOESPROC glBindVertexArray = NULL;
+PFNGLDELETEVERTEXARRAYSOESPROC glDeleteVertexArrays = NULL;
+PFNGLGETPROGRAMBINARYOESPROC glGetProgramBinary = NULL;
+PFNGLPROGRAMBINARYOESPROC glProgramBinary = NULL;
 
 OrbisGlConfig *orbisGlConf=NULL;
 int orbisgl_external_conf=-1;
@@ -53,14 +82,38 @@ void orbisGlSwapBuffers()
 		}
 	}
 }
+void orbisGlMakeCurrent(bool current)
+{
+	if(orbisGlConf)
+	{
+		if(orbisGlConf->orbisgl_initialized==1)
+		{
+			EGLBoolean ret;
+			if(current)
+			{
+				ret=eglMakeCurrent(orbisGlConf->device, orbisGlConf->surface, orbisGlConf->surface, orbisGlConf->context);
+			}
+			else
+			{
+				ret=eglMakeCurrent(orbisGlConf->device, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+			}
+			if(!ret)
+			{
+				debugNetPrintf(ERROR,"[ORBISGL] %s eglMakeCurrent failed: 0x%08X\n",__FUNCTION__,eglGetError());
+			}
+		}
+	}
+}
 void orbisGlDestroyProgram(GLuint program_id)
 {
+	RenderThreadAcquireContext();
 	int ret;
 	if(orbisGlConf && program_id>0)
 	{
 		if(orbisGlConf->orbisgl_initialized==1)
 		{
 			glDeleteProgram(program_id);
+			ForgetObjectCached(GL_CURRENT_PROGRAM, program_id);
 			ret=glGetError();
 			if(ret)
 			{
@@ -127,6 +180,7 @@ void orbisGlProgramLog(GLuint program_id)
 }
 GLuint orbisGlCompileShader(const GLenum type,const GLchar* source) 
 {
+	RenderThreadAcquireContext();
 	GLuint shader_id;
 	GLint compile_status;
 	int ret;
@@ -183,6 +237,7 @@ GLuint orbisGlCompileShader(const GLenum type,const GLchar* source)
 }
 GLuint orbisGlLinkProgram(const GLuint vertex_shader,const GLuint fragment_shader)
 {
+	RenderThreadAcquireContext();
 	GLuint program_id;
 	int ret;
 	GLint link_status;
@@ -238,6 +293,7 @@ GLuint orbisGlLinkProgram(const GLuint vertex_shader,const GLuint fragment_shade
 
 GLuint orbisGlCreateProgram(const char* vertexShaderFilename, const char* fragmentShaderFilename)
 {
+	RenderThreadAcquireContext();
     debugNetPrintf(DEBUG,"[ORBISGL] orbisGlLoadShaders %s %s\n",vertexShaderFilename,fragmentShaderFilename);
 	char * vsSource=(char *)orbisNfsGetFileContent(vertexShaderFilename);
 	if(vsSource==NULL)
@@ -245,17 +301,29 @@ GLuint orbisGlCreateProgram(const char* vertexShaderFilename, const char* fragme
 	    debugNetPrintf(DEBUG,"[ORBISGL] can't open vertex shader at %s\n",vertexShaderFilename);
 		return 0;
 	}
-	GLuint vs=orbisGlCompileShader(GL_VERTEX_SHADER,vsSource);
-	if(vs==0)
-	{
-	    debugNetPrintf(DEBUG,"[ORBISGL] can't compile vertex shader at %s\n",vertexShaderFilename);
-		return 0;
-	}
-	free(vsSource);
 	char * fsSource=(char *)orbisNfsGetFileContent(fragmentShaderFilename);
 	if(fsSource==NULL)
 	{
 	    debugNetPrintf(DEBUG,"[ORBISGL] can't open fragment shader at %s\n",vertexShaderFilename);
+		free(vsSource);
+		return 0;
+	}
+	// NOTE: Program binary cache skips compile and link when a valid binary is found
+	double startTime=GetTime();
+	GLuint po=LoadProgramBinaryCached(vsSource,fsSource);
+	if(po>0)
+	{
+		debugNetPrintf(INFO,"[ORBISGL] %s [SHDR ID %i] Program loaded from cache in %.2f ms\n",__FUNCTION__,po,(GetTime()-startTime)*1000.0);
+		free(vsSource);
+		free(fsSource);
+		return po;
+	}
+	GLuint vs=orbisGlCompileShader(GL_VERTEX_SHADER,vsSource);
+	if(vs==0)
+	{
+	    debugNetPrintf(DEBUG,"[ORBISGL] can't compile vertex shader at %s\n",vertexShaderFilename);
+		free(vsSource);
+		free(fsSource);
 		return 0;
 	}
 	GLuint fs=orbisGlCompileShader(GL_FRAGMENT_SHADER,fsSource);
@@ -263,37 +331,44 @@ GLuint orbisGlCreateProgram(const char* vertexShaderFilename, const char* fragme
 	{
 	    debugNetPrintf(DEBUG,"[ORBISGL] can't compile fragment shader at %s\n",vertexShaderFilename);
 	}
-	free(fsSource);
-	GLuint po=orbisGlLinkProgram(vs,fs);
+	po=orbisGlLinkProgram(vs,fs);
 	if(po==0)
 	{
 	    debugNetPrintf(DEBUG,"[ORBISGL] can't link program with vertex shader %d and fragment shader %d\n",vs,fs);
+		free(vsSource);
+		free(fsSource);
 		return 0;
 	}
 	glDeleteShader(vs);
 	glDeleteShader(fs);
+	debugNetPrintf(INFO,"[ORBISGL] %s [SHDR ID %i] Program compiled in %.2f ms\n",__FUNCTION__,po,(GetTime()-startTime)*1000.0);
+	SaveProgramBinaryCached(po,vsSource,fsSource);
+	free(vsSource);
+	free(fsSource);
 	
 	return po;
 }
 
 GLuint orbisGlCreateTexture(const GLsizei width,const GLsizei height,const GLenum type,const GLvoid* pixels)
 {
+	RenderThreadAcquireContext();
 	GLuint texture_id;
 	glGenTextures(1, &texture_id);
 	if(texture_id>0)
 	{
 		glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
-		glBindTexture(GL_TEXTURE_2D, texture_id);
+		BindTextureCached(GL_TEXTURE_2D, texture_id);
 		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
 		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
 		glTexImage2D(GL_TEXTURE_2D, 0, type, width, height, 0, type, GL_UNSIGNED_BYTE, pixels);
 		//glGenerateMipmap(GL_TEXTURE_2D);
-		glBindTexture(GL_TEXTURE_2D, 0);
+		BindTextureCached(GL_TEXTURE_2D, 0);
 	}
 	return texture_id;
 }
 void orbisGlDestroyTexture(GLuint texture_id)
 {
+	RenderThreadAcquireContext();
 	int ret;
 	if(orbisGlConf)
 	{
@@ -301,6 +376,7 @@ void orbisGlDestroyTexture(GLuint texture_id)
 		{
 		
 			glDeleteTextures(1,&texture_id);
+			ForgetObjectCached(GL_TEXTURE_2D, texture_id);
 			ret=glGetError();
 			if(ret)
 			{
@@ -364,6 +440,7 @@ void orbisGlFinish()
 {
 	if(orbisgl_external_conf!=1)
 	{
+		UnloadAnimationWorkers();
 		rlglClose();
 
 		if(orbisGlConf->orbisgl_initialized==1)
@@ -443,6 +520,7 @@ void BeginDrawing(void)
 {
 	if(orbisGlConf)
 	{
+		BeginProfileScope("BeginDrawing");
 		orbisGlConf->current = GetTime();// Number of elapsed seconds since InitTimer()
 		orbisGlConf->update = orbisGlConf->current - orbisGlConf->previous;
 		orbisGlConf->previous = orbisGlConf->current;
@@ -452,6 +530,7 @@ void BeginDrawing(void)
 
 		//rlTranslatef(0.375, 0.375, 0);// HACK to have 2D pixel-perfect drawing on OpenGL 1.1
 		// NOTE: Not required with OpenGL 3.3+
+		EndProfileScope();
 	}
 }
 
@@ -460,8 +539,12 @@ void EndDrawing(void)
 {
 	if(orbisGlConf)
 	{
+		BeginProfileScope("EndDrawing");
+		rlMergeThreadBatches();// Thread batches ended on this frame go last
 		rlglDraw();// Draw Buffers (Only OpenGL 3+ and ES2)
 		SwapBuffers();// Copy back buffer to front buffer
+		rlglEndFrame();// Retire batch buffers used on this frame
+		EndProfileScope();      // NOTE: Frame time control wait is not profiled
 		//PollInputEvents();
 		// Frame time control system
 		orbisGlConf->current = GetTime();
@@ -485,6 +568,7 @@ void BeginMode2D(Camera2D camera)
 {
 	if(orbisGlConf)
 	{
+		RLGL.State.flushCause = FLUSH_MODE_CHANGE;
 		rlglDraw();// Draw Buffers (Only OpenGL 3+ and ES2)
 		rlLoadIdentity();// Reset current matrix (MODELVIEW)
 		// Apply 2d camera transformation to modelview
@@ -499,6 +583,7 @@ void EndMode2D(void)
 {
 	if(orbisGlConf)
 	{
+		RLGL.State.flushCause = FLUSH_MODE_CHANGE;
 		rlglDraw();                         // Draw Buffers (Only OpenGL 3+ and ES2)
 		rlLoadIdentity();                   // Reset current matrix (MODELVIEW)
 		rlMultMatrixf(MatrixToFloat(orbisGlConf->screenScale)); // Apply screen scaling if required
@@ -510,6 +595,7 @@ void BeginMode3D(Camera3D camera)
 {
 	if(orbisGlConf)
 	{
+		RLGL.State.flushCause = FLUSH_MODE_CHANGE;
 		rlglDraw();                         // Draw Buffers (Only OpenGL 3+ and ES2)
 		rlMatrixMode(RL_PROJECTION);        // Switch to projection matrix
 		rlPushMatrix();                     // Save previous matrix, which contains the settings for the 2d ortho projection
@@ -544,6 +630,7 @@ void EndMode3D(void)
 {
 	if(orbisGlConf)
 	{
+		RLGL.State.flushCause = FLUSH_MODE_CHANGE;
 		rlglDraw();							// Process internal buffers (update + draw)
 		rlMatrixMode(RL_PROJECTION);		// Switch to projection matrix
 		rlPopMatrix();						// Restore previous matrix (PROJECTION) from matrix stack
@@ -559,6 +646,7 @@ void BeginTextureMode(RenderTexture2D target)
 {
 	if(orbisGlConf)
 	{
+		RLGL.State.flushCause = FLUSH_STATE_CHANGE;
 		rlglDraw();							// Draw Buffers (Only OpenGL 3+ and ES2)
 		rlEnableRenderTexture(target.id);	// Enable render target
 		// Set viewport to framebuffer size
@@ -583,6 +671,7 @@ void EndTextureMode(void)
 {
 	if(orbisGlConf)
 	{
+		RLGL.State.flushCause = FLUSH_STATE_CHANGE;
 		rlglDraw();							// Draw Buffers (Only OpenGL 3+ and ES2)
 		rlDisableRenderTexture();			// Disable render target
 		// Set viewport to default framebuffer size
@@ -599,6 +688,7 @@ void BeginScissorMode(int x, int y, int width, int height)
 {
 	if(orbisGlConf)
 	{
+		RLGL.State.flushCause = FLUSH_STATE_CHANGE;
 		rlglDraw(); // Force drawing elements
 		rlEnableScissorTest();
 		rlScissor(x, GetScreenHeight() - (y + height), width, height);
@@ -610,6 +700,7 @@ void EndScissorMode(void)
 {
 	if(orbisGlConf)
 	{	
+		RLGL.State.flushCause = FLUSH_STATE_CHANGE;
 		rlglDraw(); // Force drawing elements
 		rlDisableScissorTest();
 	}
@@ -758,6 +849,144 @@ double GetTime(void)
 
 }
 
+// Enable/disable CPU timing scopes recording
+// NOTE: Disabled profiler costs a single flag check per scope
+void SetProfilerEnabled(bool enabled)
+{
+	profilerEnabled = enabled;
+}
+
+// Record profiler event on calling thread ring buffer (lock-free, single writer)
+static void AddProfileEvent(const char *name, char phase)
+{
+	if (profilerRing == PROFILER_NO_RING) return;
+	if (profilerRing == NULL)
+	{
+		static bool dropLogged = false;
+		int index = __atomic_fetch_add(&profilerRingsCount, 1, __ATOMIC_RELAXED);
+		if (index < PROFILER_MAX_THREADS) profilerRing = (ProfilerRing *)calloc(1, sizeof(ProfilerRing));
+		if (profilerRing == NULL)
+		{
+			// NOTE: Cached on thread, ring is not requested again on following events
+			profilerRing = PROFILER_NO_RING;
+			if (!__atomic_exchange_n(&dropLogged, true, __ATOMIC_RELAXED)) debugNetPrintf(ERROR, "[ORBISGL] %s Profiler ring could not be assigned (max %i threads), thread events discarded\n",__FUNCTION__, PROFILER_MAX_THREADS);
+			return;
+		}
+		profilerRing->tid = index;
+		__atomic_store_n(&profilerRings[index], profilerRing, __ATOMIC_RELEASE);
+	}
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	unsigned int head = profilerRing->head;
+	ProfilerEvent *event = &profilerRing->events[head%PROFILER_RING_SIZE];
+	event->name = name;
+	event->time = (unsigned long long int)ts.tv_sec*1000000000LLU + (unsigned long long int)ts.tv_nsec;
+	event->phase = phase;
+	__atomic_store_n(&profilerRing->head, head + 1, __ATOMIC_RELEASE);
+}
+
+// Begin CPU timing scope on calling thread
+void BeginProfileScope(const char *name)
+{
+	if (profilerEnabled) AddProfileEvent(name, 'B');
+}
+
+// End last CPU timing scope begun on calling thread
+void EndProfileScope(void)
+{
+	if (profilerEnabled) AddProfileEvent(NULL, 'E');
+}
+
+// Add instant marker on calling thread timeline
+void AddProfileMarker(const char *name)
+{
+	if (profilerEnabled) AddProfileEvent(name, 'i');
+}
+
+// Write event name as JSON string content, clamped to PROFILER_NAME_LENGTH chars
+// NOTE: Up to 6 bytes are written per char (control chars as \u00XX)
+static int WriteTraceName(char *text, const char *name)
+{
+	int length = 0;
+	for (int i = 0; (name != NULL) && (name[i] != '\0') && (i < PROFILER_NAME_LENGTH); i++)
+	{
+		unsigned char c = (unsigned char)name[i];
+		if ((c == '"') || (c == '\\'))
+		{
+			text[length++] = '\\';
+			text[length++] = c;
+		}
+		else if (c < 0x20) length += sprintf(text + length, "\\u%04x", c);
+		else text[length++] = c;
+	}
+	text[length] = '\0';
+	return length;
+}
+
+// Write recorded scopes as Chrome trace_event JSON
+// NOTE: Events still being written by other threads while exporting could be skipped or torn
+bool ExportProfileTrace(const char *fileName)
+{
+	int ringsCount = __atomic_load_n(&profilerRingsCount, __ATOMIC_RELAXED);
+	if (ringsCount > PROFILER_MAX_THREADS) ringsCount = PROFILER_MAX_THREADS;
+	// Oldest event recorded is trace time origin
+	unsigned long long int base = 0;
+	for (int r = 0; r < ringsCount; r++)
+	{
+		ProfilerRing *ring = __atomic_load_n(&profilerRings[r], __ATOMIC_ACQUIRE);
+		if (ring == NULL) continue;
+		unsigned int head = __atomic_load_n(&ring->head, __ATOMIC_ACQUIRE);
+		if (head == 0) continue;
+		unsigned int first = (head > PROFILER_RING_SIZE)? head - PROFILER_RING_SIZE : 0;
+		unsigned long long int time = ring->events[first%PROFILER_RING_SIZE].time;
+		if ((base == 0) || (time < base)) base = time;
+	}
+	int file = orbisNfsOpen(fileName, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+	if (file < 0)
+	{
+		debugNetPrintf(ERROR, "[ORBISGL] %s [%s] Trace file could not be opened\n",__FUNCTION__, fileName);
+		return false;
+	}
+	int capacity = 65536;
+	char *text = (char *)malloc(capacity);
+	if (text == NULL)
+	{
+		debugNetPrintf(ERROR, "[ORBISGL] %s [%s] Trace buffer could not be allocated\n",__FUNCTION__, fileName);
+		orbisNfsClose(file);
+		return false;
+	}
+	int length = sprintf(text, "{\"traceEvents\":[");
+	int count = 0;
+	for (int r = 0; r < ringsCount; r++)
+	{
+		ProfilerRing *ring = __atomic_load_n(&profilerRings[r], __ATOMIC_ACQUIRE);
+		if (ring == NULL) continue;
+		unsigned int head = __atomic_load_n(&ring->head, __ATOMIC_ACQUIRE);
+		unsigned int first = (head > PROFILER_RING_SIZE)? head - PROFILER_RING_SIZE : 0;
+		for (unsigned int i = first; i < head; i++)
+		{
+			ProfilerEvent event = ring->events[i%PROFILER_RING_SIZE];
+			// Flush text buffer to file before it fills up (escaped names take up to 6 bytes per char)
+			if ((length + PROFILER_NAME_LENGTH*6 + 128) > capacity)
+			{
+				orbisNfsWrite(file, text, length);
+				length = 0;
+			}
+			length += sprintf(text + length, "%s{\"name\":\"", (count > 0)? ",\n" : "\n");
+			length += WriteTraceName(text + length, event.name);
+			length += sprintf(text + length, "\",\"ph\":\"%c\",\"ts\":%.3f,\"pid\":0,\"tid\":%i%s}",
+				event.phase, (double)(event.time - base)/1000.0, ring->tid, (event.phase == 'i')? ",\"s\":\"t\"" : "");
+			count++;
+		}
+	}
+	length += sprintf(text + length, "\n],\"displayTimeUnit\":\"ms\"}\n");
+	orbisNfsWrite(file, text, length);
+	orbisNfsClose(file);
+	free(text);
+	debugNetPrintf(INFO, "[ORBISGL] %s [%s] Trace exported (%i events, %i threads)\n",__FUNCTION__, fileName, count, ringsCount);
+	return true;
+}
+
 // Returns hexadecimal value for a Color
 int ColorToInt(Color color)
 {
@@ -1046,7 +1275,9 @@ void Wait(float ms)
 
 void SwapBuffers()
 {
-	orbisGlSwapBuffers();
+	// Render thread swaps buffers after executing recorded frame
+	if (rlIsRenderThreadEnabled()) RenderThreadSubmitFrame();
+	else orbisGlSwapBuffers();
 }
 
 int orbisGlCreateConf(unsigned int width,unsigned int height)
@@ -1263,7 +1494,7 @@ int orbisGlInit(unsigned int width,unsigned int height)
 		return -1;
 	}
 	debugNetPrintf(INFO,"[ORBISGL] eglMakeCurrent success.\n");
-
+	rlResetStateCache();
 
 	//const char *gl_exts = (char *) glGetString(GL_EXTENSIONS);
 	debugNetPrintf(INFO,"[ORBISGL] GL_VENDOR:   \"%s\"\n", glGetString(GL_VENDOR));
@@ -1342,6 +1573,17 @@ int orbisGlInit(unsigned int width,unsigned int height)
 		if (strcmp(extList[i], (const char *)"GL_EXT_texture_mirror_clamp") == 0) RLGL.ExtSupported.texMirrorClamp = true;
 		// Debug marker support
 		if (strcmp(extList[i], (const char *)"GL_EXT_debug_marker") == 0) RLGL.ExtSupported.debugMarker = true;
+		// 32 bit element indices support
+		if (strcmp(extList[i], (const char *)"GL_OES_element_index_uint") == 0) RLGL.ExtSupported.elementIndexUint = true;
+		// Program binary support, NOTE: Driver could expose no binary format at all
+		if (strcmp(extList[i], (const char *)"GL_OES_get_program_binary") == 0)
+		{
+			GLint formatsCount = 0;
+			glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS_OES, &formatsCount);
+			glGetProgramBinary = (PFNGLGETPROGRAMBINARYOESPROC)eglGetProcAddress("glGetProgramBinaryOES");
+			glProgramBinary = (PFNGLPROGRAMBINARYOESPROC)eglGetProcAddress("glProgramBinaryOES");
+			if ((formatsCount > 0) && (glGetProgramBinary != NULL) && (glProgramBinary != NULL)) RLGL.ExtSupported.programBinary = true;
+		}
 	}
 
 	// Free extensions pointers
@@ -1359,6 +1601,8 @@ int orbisGlInit(unsigned int width,unsigned int height)
 	if (RLGL.ExtSupported.texAnisoFilter) debugNetPrintf(INFO, "[ORBISGL] Anisotropic textures filtering supported (max: %.0fX)\n", RLGL.ExtSupported.maxAnisotropicLevel);
 	if (RLGL.ExtSupported.texMirrorClamp) debugNetPrintf(INFO, "[ORBISGL] Mirror clamp wrap texture mode supported\n");
 	if (RLGL.ExtSupported.debugMarker) debugNetPrintf(INFO, "[ORBISGL] Debug Marker supported\n");
+	if (RLGL.ExtSupported.elementIndexUint) debugNetPrintf(INFO, "[ORBISGL] 32 bit element indices supported\n");
+	if (RLGL.ExtSupported.programBinary) debugNetPrintf(INFO, "[ORBISGL] Program binaries supported, shader cache available\n");
 	// Initialize buffers, default shaders and default textures
 	//----------------------------------------------------------
 	// Init default white texture
@@ -1372,43 +1616,32 @@ int orbisGlInit(unsigned int width,unsigned int height)
 	//for debug static RLGL
 	//checkshader(RLGL.State.defaultShader,2);
 	//checkshader(RLGL.State.currentShader,3);
-	// Init default vertex arrays buffers
-	LoadBuffersDefault();
+	// Init default vertex arrays buffers and draw calls tracking system
+	// NOTE: Use rlSetBatchCapacity()/rlSetBatchGrowth() after init for bigger scenes
+	rlSetBatchCapacity(MAX_BATCH_ELEMENTS, MAX_DRAWCALL_REGISTERED);
 	// Init transformations matrix accumulator
 	RLGL.State.transform = MatrixIdentity();
-	// Init draw calls tracking system
-	RLGL.State.draws = (DrawCall *)malloc(sizeof(DrawCall)*MAX_DRAWCALL_REGISTERED);
-	for (int i = 0; i < MAX_DRAWCALL_REGISTERED; i++)
-	{
-		RLGL.State.draws[i].mode = RL_QUADS;
-		RLGL.State.draws[i].vertexCount = 0;
-		RLGL.State.draws[i].vertexAlignment = 0;
-		//RLGL.State.draws[i].vaoId = 0;
-		//RLGL.State.draws[i].shaderId = 0;
-		RLGL.State.draws[i].textureId = RLGL.State.defaultTextureId;
-		//RLGL.State.draws[i].RLGL.State.projection = MatrixIdentity();
-		//RLGL.State.draws[i].RLGL.State.modelview = MatrixIdentity();
-	}
-	RLGL.State.drawsCounter = 1;
 	// Init RLGL.State.stack matrices (emulating OpenGL 1.1)
 	for (int i = 0; i < MAX_MATRIX_STACK_SIZE; i++) RLGL.State.stack[i] = MatrixIdentity();
 	// Init RLGL.State.projection and RLGL.State.modelview matrices
 	RLGL.State.projection = MatrixIdentity();
 	RLGL.State.modelview = MatrixIdentity();
 	RLGL.State.currentMatrix = &RLGL.State.modelview;
+	RLGL.State.viewProjectionDirty = true;
+	RLGL.State.meshViewProjectionDirty = true;
 	// Initialize OpenGL default states
 	//----------------------------------------------------------
 	// Init state: Depth test
 	glDepthFunc(GL_LEQUAL);                                 // Type of depth testing to apply
-	glDisable(GL_DEPTH_TEST);                               // Disable depth testing for 2D (only used for 3D)
+	SetCapabilityCached(GL_DEPTH_TEST, false);              // Disable depth testing for 2D (only used for 3D)
 	// Init state: Blending mode
-	glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);      // Color blending function (how colors are mixed)
+	BlendFuncCached(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);  // Color blending function (how colors are mixed)
 	glEnable(GL_BLEND);                                     // Enable color blending (required to work with transparencies)
 	// Init state: Culling
 	// NOTE: All shapes/models triangles are drawn CCW
 	glCullFace(GL_BACK);                                    // Cull the back face (default)
 	glFrontFace(GL_CCW);                                    // Front face are defined counter clockwise (default)
-	glEnable(GL_CULL_FACE);                                 // Enable backface culling
+	SetCapabilityCached(GL_CULL_FACE, true);                // Enable backface culling
 
 	// Init state: Color/Depth buffers clear
 	glClearColor(0.0f, 0.0f, 0.0f, 1.0f);                   // Set clear color (black)
@@ -47,6 +47,10 @@
 #include <debugnet.h>
 #include <orbisNfs.h>
 #include <fcntl.h>
+#include <pthread.h>
+#if defined(__SSE__)
+	#include <xmmintrin.h>
+#endif
 
 #if defined(SUPPORT_MESH_GENERATION)
     #define PAR_MALLOC(T, N) ((T*)malloc(N*sizeof(T)))
@@ -60,7 +64,63 @@
 //----------------------------------------------------------------------------------
 // Defines and Macros
 //----------------------------------------------------------------------------------
-#define MAX_MESH_VBO    7               // Maximum number of vbo per mesh
+#define SKINNING_BONE_FLOATS   16       // Skinning palette floats per bone (x, y, z axes and translation columns)
+#define SKINNING_ROWS_FLOATS   12       // GPU bone matrix floats (3 rows of 4 floats)
+#define SKINNING_JOB_VERTICES  4096     // Vertex skinned by a job (meshes are split in vertex ranges)
+#define ANIMATION_WORKERS_DEFAULT 3     // Animation worker threads started on first update of several models (calling thread also skins)
+#define MAX_ANIMATION_WORKERS  8        // Maximum animation worker threads
+#define ANIMATION_FRAMERATE_DEFAULT 30.0f   // Animation frames per second if not provided by file
+#define POSE_COMPONENTS        10       // Animation pose components by bone (translation, rotation, scale)
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+
+// Skinning job, a vertex range of one mesh, or pose job evaluating a compact animation frame
+typedef struct SkinningJob {
+	Mesh mesh;
+	const float *palette;
+	int boneCount;
+	int start;                      // First vertex
+	int end;                        // Last vertex (not included)
+	ModelAnimation anim;            // Compact animation evaluated (pose jobs)
+	int frame;                      // Frame evaluated (pose jobs)
+	Transform *pose;                // Evaluated pose, NULL for skinning jobs
+} SkinningJob;
+
+//----------------------------------------------------------------------------------
+// Global Variables Definition
+//----------------------------------------------------------------------------------
+
+// Animation workers pool, jobs are taken in order by workers and calling thread
+// NOTE: Jobs array is only written while no job is pending (workers idle)
+static struct {
+	bool started;
+	pthread_t threads[MAX_ANIMATION_WORKERS];
+	int threadsCount;
+	pthread_mutex_t lock;
+	pthread_cond_t workCond;        // Jobs available or quit requested
+	pthread_cond_t doneCond;        // All jobs finished
+	SkinningJob *jobs;
+	int jobsCount;                  // Jobs available to workers
+	int jobsQueued;                 // Jobs added by calling thread (not available yet)
+	int jobsCapacity;
+	int nextJob;                    // Next job to be taken
+	int pendingJobs;                // Jobs not finished yet
+	bool quit;
+} animationWorkers = { 0 };
+
+// Animation scratch buffers, kept between updates and grown on demand (only one thread updates animations)
+static struct {
+	float *pose;                    // Pose sampled by UpdateModelAnimationTime() (components and scratch)
+	int poseSize;                   // Pose buffer size in floats
+	float *palettes;                // Skinning palettes of models updated together
+	int palettesSize;               // Palettes buffer size in floats
+} animationScratch = { 0 };
+
+static void SkinMeshVertices(Mesh mesh, const float *palette, int boneCount, int start, int end);  // Skin mesh vertex range
+static ModelAnimation *LoadAnimationsIQM(const char *fileName, int *animCount, bool compact);      // Load IQM animations (baked or compact)
+static void ResetAnimationPose(float *components, int boneCount);                                  // Reset pose components to identity transforms
 
 
 //----------------------------------------------------------------------------------
@@ -552,6 +612,7 @@ Material LoadMaterialDefault(void)
 // Load model from files (mesh and material)
 Model LoadModel(const char *fileName)
 {
+	BeginProfileScope("LoadModel");
 	Model model = { 0 };
 
 #if defined(SUPPORT_FILEFORMAT_OBJ)
@@ -590,6 +651,7 @@ Model LoadModel(const char *fileName)
 		model.materials[0] = LoadMaterialDefault();
 		if (model.meshMaterial == NULL) model.meshMaterial = (int *)calloc(model.meshCount, sizeof(int));
 	}
+	EndProfileScope();
 	return model;
 }
 
@@ -702,8 +764,60 @@ void SetModelMeshMaterial(Model *model, int meshId, int materialId)
 	else  model->meshMaterial[meshId] = materialId;
 }
 
-// Load model animations from file
-ModelAnimation *LoadModelAnimations(const char *filename, int *animCount)
+// Load model animations from file, poses of all frames are baked
+ModelAnimation *LoadModelAnimations(const char *fileName, int *animCount)
+{
+	return LoadAnimationsIQM(fileName, animCount, false);
+}
+
+// Load model animations from file keeping quantized channels (compact animations)
+// NOTE: Frame poses are evaluated when sampled (see GetModelAnimationPose())
+ModelAnimation *LoadModelAnimationsCompact(const char *fileName, int *animCount)
+{
+	return LoadAnimationsIQM(fileName, animCount, true);
+}
+
+// Evaluate animation frame pose from channels: local transforms decoded, then concatenated to parents
+// NOTE: Parent bones come before their children
+static void EvalAnimationPose(ModelAnimation anim, const AnimationChannels *channels, int frame, Transform *pose)
+{
+	const unsigned short *data = &channels->frameData[frame*channels->frameChannels];
+	for (int i = 0; i < anim.boneCount; i++)
+	{
+		const float *offset = &channels->offsets[i*10];
+		const float *scale = &channels->scales[i*10];
+		unsigned int mask = channels->masks[i];
+		float value[10];
+		for (int c = 0; c < 10; c++)
+		{
+			value[c] = offset[c];
+			if (mask & (1 << c)) value[c] += (*data++)*scale[c];
+		}
+		pose[i].translation = (Vector3){ value[0], value[1], value[2] };
+		pose[i].rotation = QuaternionNormalize((Quaternion){ value[3], value[4], value[5], value[6] });
+		pose[i].scale = (Vector3){ value[7], value[8], value[9] };
+		int parent = anim.bones[i].parent;
+		if (parent >= 0)
+		{
+			pose[i].rotation = QuaternionMultiply(pose[parent].rotation, pose[i].rotation);
+			pose[i].translation = Vector3Add(Vector3RotateByQuaternion(pose[i].translation, pose[parent].rotation), pose[parent].translation);
+			pose[i].scale = Vector3Multiply(pose[i].scale, pose[parent].scale);
+		}
+	}
+}
+
+// Get model animation frame pose (bones global transforms), pose must have room for anim.boneCount transforms
+// NOTE: Frame wraps around animation frames (negative frames included)
+void GetModelAnimationPose(ModelAnimation anim, int frame, Transform *pose)
+{
+	if ((anim.frameCount <= 0) || (anim.bones == NULL)) return;
+	frame = ((frame%anim.frameCount) + anim.frameCount)%anim.frameCount;
+	if (anim.framePoses != NULL) memcpy(pose, anim.framePoses[frame], anim.boneCount*sizeof(Transform));
+	else if (anim.channels != NULL) EvalAnimationPose(anim, anim.channels, frame, pose);
+}
+
+// Load IQM animations, baking frame poses or keeping quantized channels
+static ModelAnimation *LoadAnimationsIQM(const char *filename, int *animCount, bool compact)
 {
 	#define IQM_MAGIC       "INTERQUAKEMODEL"   // IQM file magic number
 	#define IQM_VERSION     2                   // only IQM version 2 supported
@@ -778,96 +892,48 @@ ModelAnimation *LoadModelAnimations(const char *filename, int *animCount)
 		animations[a].frameCount = anim[a].num_frames;
 		animations[a].boneCount = iqm.num_poses;
 		animations[a].bones = malloc(iqm.num_poses*sizeof(BoneInfo));
-		animations[a].framePoses = malloc(anim[a].num_frames*sizeof(Transform *));
-		//animations[a].framerate = anim.framerate;     // TODO: Use framerate?
+		animations[a].framePoses = NULL;
+		animations[a].channels = NULL;
+		animations[a].frameRate = (anim[a].framerate > 0.0f)? anim[a].framerate : ANIMATION_FRAMERATE_DEFAULT;
 		for (int j = 0; j < iqm.num_poses; j++)
 		{
 			strcpy(animations[a].bones[j].name, "ANIMJOINTNAME");
 			animations[a].bones[j].parent = poses[j].parent;
 		}
-		for (int j = 0; j < anim[a].num_frames; j++) animations[a].framePoses[j] = malloc(iqm.num_poses*sizeof(Transform));
-		int dcounter = anim[a].first_frame*iqm.num_framechannels;
-		for (int frame = 0; frame < anim[a].num_frames; frame++)
+		// Animation channels in one block: tables by bone followed by quantized frames data
+		int frameDataCount = anim[a].num_frames*iqm.num_framechannels;
+		AnimationChannels *channels = malloc(sizeof(AnimationChannels) + iqm.num_poses*(20*sizeof(float) + sizeof(unsigned int)) + frameDataCount*sizeof(unsigned short));
+		if (channels == NULL)
 		{
-			for (int i = 0; i < iqm.num_poses; i++)
-			{
-				animations[a].framePoses[frame][i].translation.x = poses[i].channeloffset[0];
-				if (poses[i].mask & 0x01)
-				{
-					animations[a].framePoses[frame][i].translation.x += framedata[dcounter]*poses[i].channelscale[0];
-					dcounter++;
-				}
-				animations[a].framePoses[frame][i].translation.y = poses[i].channeloffset[1];
-				if (poses[i].mask & 0x02)
-				{
-					animations[a].framePoses[frame][i].translation.y += framedata[dcounter]*poses[i].channelscale[1];
-					dcounter++;
-				}
-				animations[a].framePoses[frame][i].translation.z = poses[i].channeloffset[2];
-				if (poses[i].mask & 0x04)
-				{
-					animations[a].framePoses[frame][i].translation.z += framedata[dcounter]*poses[i].channelscale[2];
-					dcounter++;
-				}
-				animations[a].framePoses[frame][i].rotation.x = poses[i].channeloffset[3];
-				if (poses[i].mask & 0x08)
-				{
-					animations[a].framePoses[frame][i].rotation.x += framedata[dcounter]*poses[i].channelscale[3];
-					dcounter++;
-				}
-				animations[a].framePoses[frame][i].rotation.y = poses[i].channeloffset[4];
-				if (poses[i].mask & 0x10)
-				{
-					animations[a].framePoses[frame][i].rotation.y += framedata[dcounter]*poses[i].channelscale[4];
-					dcounter++;
-				}
-				animations[a].framePoses[frame][i].rotation.z = poses[i].channeloffset[5];
-				if (poses[i].mask & 0x20)
-				{
-					animations[a].framePoses[frame][i].rotation.z += framedata[dcounter]*poses[i].channelscale[5];
-					dcounter++;
-				}
-				animations[a].framePoses[frame][i].rotation.w = poses[i].channeloffset[6];
-				if (poses[i].mask & 0x40)
-				{
-					animations[a].framePoses[frame][i].rotation.w += framedata[dcounter]*poses[i].channelscale[6];
-					dcounter++;
-				}
-				animations[a].framePoses[frame][i].scale.x = poses[i].channeloffset[7];
-				if (poses[i].mask & 0x80)
-				{
-					animations[a].framePoses[frame][i].scale.x += framedata[dcounter]*poses[i].channelscale[7];
-					dcounter++;
-				}
-				animations[a].framePoses[frame][i].scale.y = poses[i].channeloffset[8];
-				if (poses[i].mask & 0x100)
-				{
-					animations[a].framePoses[frame][i].scale.y += framedata[dcounter]*poses[i].channelscale[8];
-					dcounter++;
-				}
-				animations[a].framePoses[frame][i].scale.z = poses[i].channeloffset[9];
-				if (poses[i].mask & 0x200)
-				{
-					animations[a].framePoses[frame][i].scale.z += framedata[dcounter]*poses[i].channelscale[9];
-					dcounter++;
-				}
-				animations[a].framePoses[frame][i].rotation = QuaternionNormalize(animations[a].framePoses[frame][i].rotation);
-			}
+			debugNetPrintf(ERROR, "[ORBISGL] %s Animation %i channels could not be allocated\n",__FUNCTION__,a);
+			animations[a].frameCount = 0;
+			continue;
+		}
+		channels->frameChannels = iqm.num_framechannels;
+		channels->offsets = (float *)(channels + 1);
+		channels->scales = channels->offsets + iqm.num_poses*10;
+		channels->masks = (unsigned int *)(channels->scales + iqm.num_poses*10);
+		channels->frameData = (unsigned short *)(channels->masks + iqm.num_poses);
+		for (int j = 0; j < iqm.num_poses; j++)
+		{
+			memcpy(&channels->offsets[j*10], poses[j].channeloffset, 10*sizeof(float));
+			memcpy(&channels->scales[j*10], poses[j].channelscale, 10*sizeof(float));
+			channels->masks[j] = poses[j].mask;
+		}
+		memcpy(channels->frameData, &framedata[anim[a].first_frame*iqm.num_framechannels], frameDataCount*sizeof(unsigned short));
+		if (compact)
+		{
+			animations[a].channels = channels;
+			continue;
 		}
 		// Build frameposes
+		animations[a].framePoses = malloc(anim[a].num_frames*sizeof(Transform *));
 		for (int frame = 0; frame < anim[a].num_frames; frame++)
 		{
-			for (int i = 0; i < animations[a].boneCount; i++)
-			{
-				if (animations[a].bones[i].parent >= 0)
-				{
-					animations[a].framePoses[frame][i].rotation = QuaternionMultiply(animations[a].framePoses[frame][animations[a].bones[i].parent].rotation, animations[a].framePoses[frame][i].rotation);
-					animations[a].framePoses[frame][i].translation = Vector3RotateByQuaternion(animations[a].framePoses[frame][i].translation, animations[a].framePoses[frame][animations[a].bones[i].parent].rotation);
-					animations[a].framePoses[frame][i].translation = Vector3Add(animations[a].framePoses[frame][i].translation, animations[a].framePoses[frame][animations[a].bones[i].parent].translation);
-					animations[a].framePoses[frame][i].scale = Vector3Multiply(animations[a].framePoses[frame][i].scale, animations[a].framePoses[frame][animations[a].bones[i].parent].scale);
-				}
-			}
+			animations[a].framePoses[frame] = malloc(iqm.num_poses*sizeof(Transform));
+			EvalAnimationPose(animations[a], channels, frame, animations[a].framePoses[frame]);
 		}
+		free(channels);
 	}
 	free(framedata);
 	free(poses);
@@ -875,68 +941,738 @@ ModelAnimation *LoadModelAnimations(const char *filename, int *animCount)
 	return animations;
 }
 
+// Build skinning palette, one bind-inverse times frame pose matrix by bone
+// NOTE: Matrix is stored as 4 columns (x, y, z axes and translation), w components are unused
+static void BuildSkinningPalette(const Transform *bindPose, const Transform *framePose, int boneCount, float *palette)
+{
+	for (int b = 0; b < boneCount; b++)
+	{
+		Quaternion bindRotation = QuaternionInvert(bindPose[b].rotation);
+		Vector3 bindScale = bindPose[b].scale;
+		float *bone = &palette[b*SKINNING_BONE_FLOATS];
+		for (int c = 0; c < 3; c++)
+		{
+			// Axis from model space to bone space (bind inverse), then to model space on frame pose
+			Vector3 axis = Vector3RotateByQuaternion((Vector3){ (c == 0)? 1.0f : 0.0f, (c == 1)? 1.0f : 0.0f, (c == 2)? 1.0f : 0.0f }, bindRotation);
+			axis = (Vector3){ axis.x/bindScale.x, axis.y/bindScale.y, axis.z/bindScale.z };
+			axis = Vector3RotateByQuaternion(Vector3Multiply(axis, framePose[b].scale), framePose[b].rotation);
+			bone[c*4] = axis.x;
+			bone[c*4 + 1] = axis.y;
+			bone[c*4 + 2] = axis.z;
+			bone[c*4 + 3] = 0.0f;
+		}
+		// Translation: frame translation minus bind translation through the axes
+		Vector3 t = bindPose[b].translation;
+		bone[12] = framePose[b].translation.x - (bone[0]*t.x + bone[4]*t.y + bone[8]*t.z);
+		bone[13] = framePose[b].translation.y - (bone[1]*t.x + bone[5]*t.y + bone[9]*t.z);
+		bone[14] = framePose[b].translation.z - (bone[2]*t.x + bone[6]*t.y + bone[10]*t.z);
+		bone[15] = 1.0f;
+	}
+}
+
+// Check if model mesh can be skinned on GPU: GPU skinning enabled, bones fit on shader and
+// mesh drawn with a shader providing skinning (default shader, material shader or its variant)
+// NOTE: Models with more than MAX_SKINNING_BONES bones are skinned on CPU (meshes are not split by bones subsets)
+static bool IsMeshGpuSkinned(Model model, int m, int boneCount)
+{
+	static int warnedBoneCount = 0;
+	if (!rlIsGpuSkinningEnabled()) return false;
+	if (boneCount > MAX_SKINNING_BONES)
+	{
+		if (boneCount != warnedBoneCount) debugNetPrintf(INFO, "[ORBISGL] %s Model with %i bones (GPU skinning up to %i), skinned on CPU\n",__FUNCTION__, boneCount, MAX_SKINNING_BONES);
+		warnedBoneCount = boneCount;
+		return false;
+	}
+	Material material = { 0 };
+	if ((model.materials != NULL) && (model.meshMaterial != NULL)) material = model.materials[model.meshMaterial[m]];
+	else material.shader = GetShaderDefault();      // Drawn with default material
+	return rlCheckGpuSkinning(model.meshes[m], material);
+}
+
+// Set mesh bone matrices from skinning palette (transposed to 3 rows by bone, uploaded on mesh drawing)
+// NOTE: Vertex and normals buffers must keep bind pose, they are restored when mesh was skinned on CPU before
+static void SetMeshBoneMatrices(Mesh *mesh, const float *palette, int boneCount)
+{
+	if (mesh->boneMatrices == NULL)
+	{
+		mesh->boneMatrices = (float *)malloc(MAX_SKINNING_BONES*SKINNING_ROWS_FLOATS*sizeof(float));
+		if (mesh->boneMatrices == NULL) return;
+		rlUpdateBuffer(mesh->vboId[0], mesh->vertices, mesh->vertexCount*3*sizeof(float));
+		if ((mesh->normals != NULL) && (mesh->animNormals != NULL)) rlUpdateBuffer(mesh->vboId[2], mesh->normals, mesh->vertexCount*3*sizeof(float));
+	}
+	for (int b = 0; b < boneCount; b++)
+	{
+		const float *bone = &palette[b*SKINNING_BONE_FLOATS];
+		float *rows = &mesh->boneMatrices[b*SKINNING_ROWS_FLOATS];
+		for (int r = 0; r < 3; r++)
+		{
+			rows[r*4] = bone[r];
+			rows[r*4 + 1] = bone[4 + r];
+			rows[r*4 + 2] = bone[8 + r];
+			rows[r*4 + 3] = bone[12 + r];
+		}
+	}
+	mesh->boneCount = boneCount;
+}
+
+// Skin mesh vertices and normals of a vertex range, blending up to 4 palette matrices by vertex weights
+// NOTE: Blended matrix is built first, so every vertex costs one transform whatever its bones count,
+// weights are normalized by their total and skinned normals are renormalized
+static void SkinMeshVertices(Mesh mesh, const float *palette, int boneCount, int start, int end)
+{
+	const float *vertices = mesh.vertices;
+	const float *normals = (mesh.animNormals != NULL)? mesh.normals : NULL;
+	float *animVertices = mesh.animVertices;
+	float *animNormals = mesh.animNormals;
+	for (int i = start; i < end; i++)
+	{
+		const int *ids = &mesh.boneIds[i*4];
+		const float *weights = &mesh.boneWeights[i*4];
+		float totalWeight = 0.0f;
+#if defined(__SSE__)
+		__m128 col0 = _mm_setzero_ps();
+		__m128 col1 = _mm_setzero_ps();
+		__m128 col2 = _mm_setzero_ps();
+		__m128 col3 = _mm_setzero_ps();
+		for (int k = 0; k < 4; k++)
+		{
+			if ((weights[k] == 0.0f) || (ids[k] < 0) || (ids[k] >= boneCount)) continue;
+			const float *bone = &palette[ids[k]*SKINNING_BONE_FLOATS];
+			__m128 weight = _mm_set1_ps(weights[k]);
+			col0 = _mm_add_ps(col0, _mm_mul_ps(weight, _mm_loadu_ps(bone)));
+			col1 = _mm_add_ps(col1, _mm_mul_ps(weight, _mm_loadu_ps(bone + 4)));
+			col2 = _mm_add_ps(col2, _mm_mul_ps(weight, _mm_loadu_ps(bone + 8)));
+			col3 = _mm_add_ps(col3, _mm_mul_ps(weight, _mm_loadu_ps(bone + 12)));
+			totalWeight += weights[k];
+		}
+		if (totalWeight > 0.0f)
+		{
+			if (totalWeight != 1.0f)
+			{
+				__m128 iweight = _mm_set1_ps(1.0f/totalWeight);
+				col0 = _mm_mul_ps(col0, iweight);
+				col1 = _mm_mul_ps(col1, iweight);
+				col2 = _mm_mul_ps(col2, iweight);
+				col3 = _mm_mul_ps(col3, iweight);
+			}
+			float result[4];
+			__m128 position = _mm_add_ps(_mm_add_ps(_mm_mul_ps(col0, _mm_set1_ps(vertices[i*3])), _mm_mul_ps(col1, _mm_set1_ps(vertices[i*3 + 1]))),
+										 _mm_add_ps(_mm_mul_ps(col2, _mm_set1_ps(vertices[i*3 + 2])), col3));
+			_mm_storeu_ps(result, position);
+			memcpy(&animVertices[i*3], result, 3*sizeof(float));
+			if (normals != NULL)
+			{
+				__m128 normal = _mm_add_ps(_mm_add_ps(_mm_mul_ps(col0, _mm_set1_ps(normals[i*3])), _mm_mul_ps(col1, _mm_set1_ps(normals[i*3 + 1]))),
+										   _mm_mul_ps(col2, _mm_set1_ps(normals[i*3 + 2])));
+				_mm_storeu_ps(result, normal);
+				float length = result[0]*result[0] + result[1]*result[1] + result[2]*result[2];
+				float ilength = (length > 0.0f)? 1.0f/sqrtf(length) : 0.0f;
+				animNormals[i*3] = result[0]*ilength;
+				animNormals[i*3 + 1] = result[1]*ilength;
+				animNormals[i*3 + 2] = result[2]*ilength;
+			}
+			continue;
+		}
+#else
+		float m[12] = { 0 };
+		for (int k = 0; k < 4; k++)
+		{
+			if ((weights[k] == 0.0f) || (ids[k] < 0) || (ids[k] >= boneCount)) continue;
+			const float *bone = &palette[ids[k]*SKINNING_BONE_FLOATS];
+			for (int j = 0; j < 3; j++)
+			{
+				m[j] += weights[k]*bone[j];
+				m[3 + j] += weights[k]*bone[4 + j];
+				m[6 + j] += weights[k]*bone[8 + j];
+				m[9 + j] += weights[k]*bone[12 + j];
+			}
+			totalWeight += weights[k];
+		}
+		if (totalWeight > 0.0f)
+		{
+			if (totalWeight != 1.0f) for (int j = 0; j < 12; j++) m[j] /= totalWeight;
+			float x = vertices[i*3], y = vertices[i*3 + 1], z = vertices[i*3 + 2];
+			animVertices[i*3] = m[0]*x + m[3]*y + m[6]*z + m[9];
+			animVertices[i*3 + 1] = m[1]*x + m[4]*y + m[7]*z + m[10];
+			animVertices[i*3 + 2] = m[2]*x + m[5]*y + m[8]*z + m[11];
+			if (normals != NULL)
+			{
+				x = normals[i*3]; y = normals[i*3 + 1]; z = normals[i*3 + 2];
+				float nx = m[0]*x + m[3]*y + m[6]*z;
+				float ny = m[1]*x + m[4]*y + m[7]*z;
+				float nz = m[2]*x + m[5]*y + m[8]*z;
+				float length = nx*nx + ny*ny + nz*nz;
+				float ilength = (length > 0.0f)? 1.0f/sqrtf(length) : 0.0f;
+				animNormals[i*3] = nx*ilength;
+				animNormals[i*3 + 1] = ny*ilength;
+				animNormals[i*3 + 2] = nz*ilength;
+			}
+			continue;
+		}
+#endif
+		// Vertex without bone influence keeps its bind position
+		memcpy(&animVertices[i*3], &vertices[i*3], 3*sizeof(float));
+		if (normals != NULL) memcpy(&animNormals[i*3], &normals[i*3], 3*sizeof(float));
+	}
+}
+
+// Run one job: pose evaluation or vertex range skinning
+static void RunAnimationJob(SkinningJob job)
+{
+	if (job.pose != NULL) EvalAnimationPose(job.anim, job.anim.channels, job.frame, job.pose);
+	else SkinMeshVertices(job.mesh, job.palette, job.boneCount, job.start, job.end);
+}
+
+// Take and run jobs until none is left, lock must be held (it's released while skinning)
+static void RunSkinningJobs(void)
+{
+	while (animationWorkers.nextJob < animationWorkers.jobsCount)
+	{
+		SkinningJob job = animationWorkers.jobs[animationWorkers.nextJob++];
+		pthread_mutex_unlock(&animationWorkers.lock);
+		RunAnimationJob(job);
+		pthread_mutex_lock(&animationWorkers.lock);
+		animationWorkers.pendingJobs--;
+		if (animationWorkers.pendingJobs == 0) pthread_cond_signal(&animationWorkers.doneCond);
+	}
+}
+
+// Animation worker thread main loop
+static void *AnimationWorkerMain(void *arg)
+{
+	pthread_mutex_lock(&animationWorkers.lock);
+	while (!animationWorkers.quit)
+	{
+		RunSkinningJobs();
+		if (!animationWorkers.quit) pthread_cond_wait(&animationWorkers.workCond, &animationWorkers.lock);
+	}
+	pthread_mutex_unlock(&animationWorkers.lock);
+	return NULL;
+}
+
+// Set animation worker threads used by UpdateModelAnimations() (0 skins on calling thread only)
+// NOTE: If not set, workers are started with ANIMATION_WORKERS_DEFAULT threads on first update of several models,
+// single model updates (UpdateModelAnimation()) run on calling thread until workers are started
+void SetAnimationWorkers(int count)
+{
+	UnloadAnimationWorkers();
+	if (count > MAX_ANIMATION_WORKERS) count = MAX_ANIMATION_WORKERS;
+	pthread_mutex_init(&animationWorkers.lock, NULL);
+	pthread_cond_init(&animationWorkers.workCond, NULL);
+	pthread_cond_init(&animationWorkers.doneCond, NULL);
+	animationWorkers.quit = false;
+	animationWorkers.started = true;
+	for (int i = 0; i < count; i++)
+	{
+		if (pthread_create(&animationWorkers.threads[i], NULL, AnimationWorkerMain, NULL) != 0)
+		{
+			debugNetPrintf(ERROR, "[ORBISGL] %s Animation worker %i could not be created\n",__FUNCTION__,i);
+			break;
+		}
+		animationWorkers.threadsCount++;
+	}
+	debugNetPrintf(INFO, "[ORBISGL] %s %i animation workers started\n",__FUNCTION__,animationWorkers.threadsCount);
+}
+
+// Stop animation worker threads and unload jobs and scratch memory
+void UnloadAnimationWorkers(void)
+{
+	free(animationScratch.pose);
+	free(animationScratch.palettes);
+	memset(&animationScratch, 0, sizeof(animationScratch));
+	if (!animationWorkers.started) return;
+	pthread_mutex_lock(&animationWorkers.lock);
+	animationWorkers.quit = true;
+	pthread_cond_broadcast(&animationWorkers.workCond);
+	pthread_mutex_unlock(&animationWorkers.lock);
+	for (int i = 0; i < animationWorkers.threadsCount; i++) pthread_join(animationWorkers.threads[i], NULL);
+	pthread_mutex_destroy(&animationWorkers.lock);
+	pthread_cond_destroy(&animationWorkers.workCond);
+	pthread_cond_destroy(&animationWorkers.doneCond);
+	free(animationWorkers.jobs);
+	memset(&animationWorkers, 0, sizeof(animationWorkers));
+}
+
+// Add a job to the queue (cleared), NULL if jobs array could not grow
+static SkinningJob *AddAnimationJob(void)
+{
+	if (animationWorkers.jobsQueued >= animationWorkers.jobsCapacity)
+	{
+		int capacity = (animationWorkers.jobsCapacity > 0)? animationWorkers.jobsCapacity*2 : 64;
+		SkinningJob *jobs = (SkinningJob *)realloc(animationWorkers.jobs, capacity*sizeof(SkinningJob));
+		if (jobs == NULL) return NULL;
+		animationWorkers.jobs = jobs;
+		animationWorkers.jobsCapacity = capacity;
+	}
+	SkinningJob *job = &animationWorkers.jobs[animationWorkers.jobsQueued++];
+	memset(job, 0, sizeof(SkinningJob));
+	return job;
+}
+
+// Run queued jobs with workers and calling thread, returns once all of them are finished (single sync point)
+// NOTE: Queued jobs are kept on jobs array until next jobs are queued, jobs run on calling thread if workers are not started
+static void RunAnimationJobs(void)
+{
+	int jobsCount = animationWorkers.jobsQueued;
+	if (!animationWorkers.started)
+	{
+		for (int j = 0; j < jobsCount; j++) RunAnimationJob(animationWorkers.jobs[j]);
+		return;
+	}
+	pthread_mutex_lock(&animationWorkers.lock);
+	animationWorkers.jobsCount = jobsCount;
+	animationWorkers.nextJob = 0;
+	animationWorkers.pendingJobs = jobsCount;
+	if (jobsCount > 1) pthread_cond_broadcast(&animationWorkers.workCond);
+	RunSkinningJobs();
+	while (animationWorkers.pendingJobs > 0) pthread_cond_wait(&animationWorkers.doneCond, &animationWorkers.lock);
+	animationWorkers.jobsCount = 0;
+	pthread_mutex_unlock(&animationWorkers.lock);
+}
+
+// Add skinning jobs for mesh vertex ranges
+static bool AddSkinningJobs(Mesh mesh, const float *palette, int boneCount)
+{
+	for (int start = 0; start < mesh.vertexCount; start += SKINNING_JOB_VERTICES)
+	{
+		SkinningJob *job = AddAnimationJob();
+		if (job == NULL) return false;
+		job->mesh = mesh;
+		job->palette = palette;
+		job->boneCount = boneCount;
+		job->start = start;
+		job->end = (start + SKINNING_JOB_VERTICES < mesh.vertexCount)? start + SKINNING_JOB_VERTICES : mesh.vertexCount;
+	}
+	return true;
+}
+
+// Check if mesh animated vertex data is shared with a mesh of a model skinned later on the same update
+static bool IsMeshSkinnedLater(Model *models, Transform **poses, int count, int i, Mesh mesh)
+{
+	for (int j = i + 1; j < count; j++)
+	{
+		if ((poses[j] == NULL) || (models[j].bindPose == NULL)) continue;
+		for (int m = 0; m < models[j].meshCount; m++) if (models[j].meshes[m].animVertices == mesh.animVertices) return true;
+	}
+	return false;
+}
+
+// Skin several models with their bones global poses (NULL poses are skipped)
+// NOTE: Meshes are skinned by vertex ranges on animation workers and calling thread,
+// updated data is uploaded to GPU by calling thread once all jobs are finished (only one thread can update animations).
+// A mesh shared by several models (same model passed twice) is only skinned with last model pose, like serial updates
+static void SkinModels(Model *models, Transform **poses, const int *boneCounts, int count)
+{
+	// Skinning palettes of all models in one block kept between updates, matrices are computed once per bone, not per vertex
+	int paletteSize = 0;
+	for (int i = 0; i < count; i++) paletteSize += boneCounts[i]*SKINNING_BONE_FLOATS;
+	if (animationScratch.palettesSize < paletteSize)
+	{
+		float *palettes = (float *)realloc(animationScratch.palettes, paletteSize*sizeof(float));
+		if (palettes == NULL)
+		{
+			debugNetPrintf(ERROR, "[ORBISGL] %s Skinning palettes could not be allocated\n",__FUNCTION__);
+			return;
+		}
+		animationScratch.palettes = palettes;
+		animationScratch.palettesSize = paletteSize;
+	}
+	float *palette = animationScratch.palettes;
+	animationWorkers.jobsQueued = 0;
+	for (int i = 0; i < count; i++)
+	{
+		Model model = models[i];
+		int boneCount = boneCounts[i];
+		if ((poses[i] == NULL) || (model.bindPose == NULL)) continue;
+		BuildSkinningPalette(model.bindPose, poses[i], boneCount, palette);
+		for (int m = 0; m < model.meshCount; m++)
+		{
+			if ((model.meshes[m].boneIds == NULL) || (model.meshes[m].boneWeights == NULL) || (model.meshes[m].animVertices == NULL)) continue;
+			if (IsMeshGpuSkinned(model, m, boneCount))
+			{
+				SetMeshBoneMatrices(&model.meshes[m], palette, boneCount);
+				continue;
+			}
+			if (model.meshes[m].boneMatrices != NULL)
+			{
+				free(model.meshes[m].boneMatrices);
+				model.meshes[m].boneMatrices = NULL;
+				model.meshes[m].boneCount = 0;
+			}
+			if (IsMeshSkinnedLater(models, poses, count, i, model.meshes[m])) continue;
+			if (!AddSkinningJobs(model.meshes[m], palette, boneCount)) debugNetPrintf(ERROR, "[ORBISGL] %s Skinning jobs could not be allocated\n",__FUNCTION__);
+		}
+		palette += boneCount*SKINNING_BONE_FLOATS;
+	}
+	RunAnimationJobs();
+	int jobsCount = animationWorkers.jobsQueued;
+	// Upload new vertex data to GPU for model drawing (first job of every mesh)
+	for (int j = 0; j < jobsCount; j++)
+	{
+		Mesh mesh = animationWorkers.jobs[j].mesh;
+		if (animationWorkers.jobs[j].start != 0) continue;
+		rlUpdateBuffer(mesh.vboId[0], mesh.animVertices, mesh.vertexCount*3*sizeof(float));    // Update vertex position
+		if (mesh.animNormals != NULL) rlUpdateBuffer(mesh.vboId[2], mesh.animNormals, mesh.vertexCount*3*sizeof(float));     // Update vertex normals
+	}
+}
+
+// Update animated vertex data of several models, each one with its animation frame
+// NOTE: Frame poses of compact animations are evaluated on animation workers, then models are skinned (see SkinModels())
+void UpdateModelAnimations(Model *models, ModelAnimation *anims, int *frames, int count)
+{
+	if (count <= 0) return;
+	if (!animationWorkers.started && (count > 1)) SetAnimationWorkers(ANIMATION_WORKERS_DEFAULT);
+	BeginProfileScope("UpdateModelAnimations");
+	// Frame pose of compact animations is evaluated on scratch poses, baked poses are used directly
+	int poseSize = 0;
+	for (int i = 0; i < count; i++) if (anims[i].framePoses == NULL) poseSize += anims[i].boneCount;
+	Transform **poses = (Transform **)calloc(count, sizeof(Transform *));
+	int *boneCounts = (int *)calloc(count, sizeof(int));
+	Transform *scratch = (poseSize > 0)? (Transform *)malloc(poseSize*sizeof(Transform)) : NULL;
+	if ((poses == NULL) || (boneCounts == NULL) || ((poseSize > 0) && (scratch == NULL)))
+	{
+		debugNetPrintf(ERROR, "[ORBISGL] %s Animation poses could not be allocated\n",__FUNCTION__);
+		free(poses);
+		free(boneCounts);
+		free(scratch);
+		EndProfileScope();
+		return;
+	}
+	Transform *pose = scratch;
+	animationWorkers.jobsQueued = 0;
+	for (int i = 0; i < count; i++)
+	{
+		ModelAnimation anim = anims[i];
+		if ((anim.frameCount <= 0) || (anim.bones == NULL) || ((anim.framePoses == NULL) && (anim.channels == NULL))) continue;
+		int frame = ((frames[i]%anim.frameCount) + anim.frameCount)%anim.frameCount;
+		if (anim.framePoses != NULL) poses[i] = anim.framePoses[frame];
+		else
+		{
+			SkinningJob *job = AddAnimationJob();
+			if (job == NULL)
+			{
+				debugNetPrintf(ERROR, "[ORBISGL] %s Pose jobs could not be allocated\n",__FUNCTION__);
+				continue;
+			}
+			job->anim = anim;
+			job->frame = frame;
+			job->pose = pose;
+			poses[i] = pose;
+			pose += anim.boneCount;
+		}
+		boneCounts[i] = (anim.boneCount < models[i].boneCount)? anim.boneCount : models[i].boneCount;
+	}
+	RunAnimationJobs();
+	SkinModels(models, poses, boneCounts, count);
+	free(poses);
+	free(boneCounts);
+	free(scratch);
+	EndProfileScope();
+}
+
 // Update model animated vertex data (positions and normals) for a given frame
 // NOTE: Updated data is uploaded to GPU
 void UpdateModelAnimation(Model model, ModelAnimation anim, int frame)
 {
-	if ((anim.frameCount > 0) && (anim.bones != NULL) && (anim.framePoses != NULL))
+	UpdateModelAnimations(&model, &anim, &frame, 1);
+}
+
+// Update model animated vertex data (positions and normals) at time in seconds, adjacent frames are interpolated
+// NOTE: Pose is sampled on a scratch buffer kept between calls
+void UpdateModelAnimationTime(Model model, ModelAnimation anim, float time)
+{
+	if (anim.boneCount <= 0) return;
+	int size = 4*POSE_COMPONENTS*anim.boneCount;
+	if (animationScratch.poseSize < size)
 	{
-		if (frame >= anim.frameCount) frame = frame%anim.frameCount;
-		for (int m = 0; m < model.meshCount; m++)
+		float *buffer = (float *)realloc(animationScratch.pose, size*sizeof(float));
+		if (buffer == NULL)
+		{
+			debugNetPrintf(ERROR, "[ORBISGL] %s Animation pose could not be allocated\n",__FUNCTION__);
+			return;
+		}
+		animationScratch.pose = buffer;
+		animationScratch.poseSize = size;
+	}
+	AnimationPose pose = { anim.boneCount, animationScratch.pose, animationScratch.pose + POSE_COMPONENTS*anim.boneCount };
+	if (SampleModelAnimation(anim, time, pose)) UpdateModelAnimationPoses(&model, &pose, 1);
+}
+
+// Load animation pose for blending, bones start with identity transforms
+// NOTE: Sampling and blending scratch is allocated in the same block
+AnimationPose LoadAnimationPose(int boneCount)
+{
+	AnimationPose pose = { 0 };
+	if (boneCount <= 0) return pose;
+	pose.components = (float *)malloc(4*POSE_COMPONENTS*boneCount*sizeof(float));
+	if (pose.components == NULL)
+	{
+		debugNetPrintf(ERROR, "[ORBISGL] %s Animation pose could not be allocated\n",__FUNCTION__);
+		return pose;
+	}
+	pose.boneCount = boneCount;
+	pose.scratch = pose.components + POSE_COMPONENTS*boneCount;
+	ResetAnimationPose(pose.components, boneCount);
+	return pose;
+}
+
+// Unload animation pose
+void UnloadAnimationPose(AnimationPose pose)
+{
+	free(pose.components);
+}
+
+// Reset pose components to identity transforms
+static void ResetAnimationPose(float *components, int boneCount)
+{
+	memset(components, 0, 7*boneCount*sizeof(float));
+	for (int b = 0; b < boneCount; b++) components[6*boneCount + b] = 1.0f;
+	for (int b = 0; b < 3*boneCount; b++) components[7*boneCount + b] = 1.0f;
+}
+
+// Get animation frame local pose into components arrays (rotations not normalized)
+// NOTE: Baked poses are global, they are converted back to parent bones space
+static void GetAnimationLocalPose(ModelAnimation anim, int frame, float *components)
+{
+	int n = anim.boneCount;
+	if (anim.channels != NULL)
+	{
+		const AnimationChannels *channels = anim.channels;
+		const unsigned short *data = &channels->frameData[frame*channels->frameChannels];
+		for (int b = 0; b < n; b++)
+		{
+			const float *offset = &channels->offsets[b*POSE_COMPONENTS];
+			const float *scale = &channels->scales[b*POSE_COMPONENTS];
+			unsigned int mask = channels->masks[b];
+			for (int c = 0; c < POSE_COMPONENTS; c++)
+			{
+				components[c*n + b] = offset[c];
+				if (mask & (1 << c)) components[c*n + b] += (*data++)*scale[c];
+			}
+		}
+		return;
+	}
+	const Transform *pose = anim.framePoses[frame];
+	for (int b = 0; b < n; b++)
+	{
+		Transform local = pose[b];
+		int parent = anim.bones[b].parent;
+		if ((parent >= 0) && (parent < b))
+		{
+			Quaternion inverse = QuaternionInvert(pose[parent].rotation);
+			local.rotation = QuaternionMultiply(inverse, pose[b].rotation);
+			local.translation = Vector3RotateByQuaternion(Vector3Subtract(pose[b].translation, pose[parent].translation), inverse);
+			local.scale = Vector3DivideV(pose[b].scale, pose[parent].scale);
+		}
+		components[b] = local.translation.x;
+		components[n + b] = local.translation.y;
+		components[2*n + b] = local.translation.z;
+		components[3*n + b] = local.rotation.x;
+		components[4*n + b] = local.rotation.y;
+		components[5*n + b] = local.rotation.z;
+		components[6*n + b] = local.rotation.w;
+		components[7*n + b] = local.scale.x;
+		components[8*n + b] = local.scale.y;
+		components[9*n + b] = local.scale.z;
+	}
+}
+
+// Normalize pose rotations (identity for zero length rotations)
+static void NormalizePoseRotations(float *components, int n)
+{
+	float *rx = &components[3*n], *ry = &components[4*n], *rz = &components[5*n], *rw = &components[6*n];
+	for (int b = 0; b < n; b++)
+	{
+		float length = sqrtf(rx[b]*rx[b] + ry[b]*ry[b] + rz[b]*rz[b] + rw[b]*rw[b]);
+		if (length > 0.0f)
+		{
+			float ilength = 1.0f/length;
+			rx[b] *= ilength; ry[b] *= ilength; rz[b] *= ilength; rw[b] *= ilength;
+		}
+		else
+		{
+			rx[b] = 0.0f; ry[b] = 0.0f; rz[b] = 0.0f; rw[b] = 1.0f;
+		}
+	}
+}
+
+// Sample animation local pose at time in seconds, adjacent frames are interpolated (lerp, rotations nlerp)
+// NOTE: Animation loops, last frame is interpolated to first one. Pose is not modified if animation can't be sampled
+bool SampleModelAnimation(ModelAnimation anim, float time, AnimationPose pose)
+{
+	if ((pose.components == NULL) || (pose.scratch == NULL)) return false;
+	if ((anim.frameCount <= 0) || (anim.bones == NULL) || ((anim.framePoses == NULL) && (anim.channels == NULL))) return false;
+	if (anim.boneCount != pose.boneCount)
+	{
+		debugNetPrintf(ERROR, "[ORBISGL] %s Animation bones (%i) do not match pose bones (%i)\n",__FUNCTION__,anim.boneCount,pose.boneCount);
+		return false;
+	}
+	int n = pose.boneCount;
+	float frameRate = (anim.frameRate > 0.0f)? anim.frameRate : ANIMATION_FRAMERATE_DEFAULT;
+	float position = fmodf(time*frameRate, (float)anim.frameCount);
+	if (position < 0.0f) position += anim.frameCount;
+	int frame = (int)position;
+	if (frame >= anim.frameCount) frame = anim.frameCount - 1;
+	float alpha = position - frame;
+	GetAnimationLocalPose(anim, frame, pose.components);
+	if ((alpha > 0.0f) && (anim.frameCount > 1))
+	{
+		float *next = pose.scratch;
+		GetAnimationLocalPose(anim, (frame + 1)%anim.frameCount, next);
+		NormalizePoseRotations(pose.components, n);
+		NormalizePoseRotations(next, n);
+		float *c = pose.components;
+		for (int i = 0; i < 3*n; i++) c[i] += (next[i] - c[i])*alpha;                  // Translation
+		for (int i = 7*n; i < 10*n; i++) c[i] += (next[i] - c[i])*alpha;               // Scale
+		float *rx = &c[3*n], *ry = &c[4*n], *rz = &c[5*n], *rw = &c[6*n];
+		const float *nx = &next[3*n], *ny = &next[4*n], *nz = &next[5*n], *nw = &next[6*n];
+		for (int b = 0; b < n; b++)
+		{
+			// Shortest path: next rotation negated if it's on the opposite hemisphere
+			float sign = ((rx[b]*nx[b] + ry[b]*ny[b] + rz[b]*nz[b] + rw[b]*nw[b]) < 0.0f)? -alpha : alpha;
+			rx[b] += nx[b]*sign - rx[b]*alpha;
+			ry[b] += ny[b]*sign - ry[b]*alpha;
+			rz[b] += nz[b]*sign - rz[b]*alpha;
+			rw[b] += nw[b]*sign - rw[b]*alpha;
+		}
+	}
+	NormalizePoseRotations(pose.components, n);
+	return true;
+}
+
+// Blend animation layers into pose, every layer sampled at its time
+// NOTE: Non additive layers are averaged by weight (crossfades), additive layers then add their
+// difference to first frame scaled by weight (translation added, rotation and scale multiplied).
+// Layers that can't be sampled are skipped, layers are sampled on pose scratch components
+void BlendModelAnimations(const AnimationLayer *layers, int count, AnimationPose pose)
+{
+	if ((pose.components == NULL) || (pose.scratch == NULL)) return;
+	int n = pose.boneCount;
+	float *sample = pose.scratch;
+	float *reference = sample + POSE_COMPONENTS*n;
+	AnimationPose samplePose = { n, sample, reference + POSE_COMPONENTS*n };
+	float *c = pose.components;
+	float *rx = &c[3*n], *ry = &c[4*n], *rz = &c[5*n], *rw = &c[6*n];
+	const float *sx = &sample[3*n], *sy = &sample[4*n], *sz = &sample[5*n], *sw = &sample[6*n];
+	// Weighted average of non additive layers
+	float totalWeight = 0.0f;
+	memset(c, 0, POSE_COMPONENTS*n*sizeof(float));
+	for (int l = 0; l < count; l++)
+	{
+		float weight = layers[l].weight;
+		if (layers[l].additive || (weight <= 0.0f) || (layers[l].anim.boneCount != n)) continue;
+		if (!SampleModelAnimation(layers[l].anim, layers[l].time, samplePose)) continue;
+		for (int i = 0; i < 3*n; i++) c[i] += sample[i]*weight;
+		for (int i = 7*n; i < 10*n; i++) c[i] += sample[i]*weight;
+		for (int b = 0; b < n; b++)
+		{
+			float sign = ((rx[b]*sx[b] + ry[b]*sy[b] + rz[b]*sz[b] + rw[b]*sw[b]) < 0.0f)? -weight : weight;
+			rx[b] += sx[b]*sign;
+			ry[b] += sy[b]*sign;
+			rz[b] += sz[b]*sign;
+			rw[b] += sw[b]*sign;
+		}
+		totalWeight += weight;
+	}
+	if (totalWeight > 0.0f)
+	{
+		float iweight = 1.0f/totalWeight;
+		for (int i = 0; i < 3*n; i++) c[i] *= iweight;
+		for (int i = 7*n; i < 10*n; i++) c[i] *= iweight;
+		NormalizePoseRotations(c, n);
+	}
+	else ResetAnimationPose(c, n);
+	// Additive layers, difference to first frame
+	for (int l = 0; l < count; l++)
+	{
+		float weight = layers[l].weight;
+		if (!layers[l].additive || (weight <= 0.0f) || (layers[l].anim.boneCount != n)) continue;
+		if (!SampleModelAnimation(layers[l].anim, layers[l].time, samplePose)) continue;
+		GetAnimationLocalPose(layers[l].anim, 0, reference);        // Sampled animation provides frames
+		NormalizePoseRotations(reference, n);
+		for (int i = 0; i < 3*n; i++) c[i] += (sample[i] - reference[i])*weight;
+		for (int i = 7*n; i < 10*n; i++) if (reference[i] != 0.0f) c[i] *= 1.0f + (sample[i]/reference[i] - 1.0f)*weight;
+		const float *qx = &reference[3*n], *qy = &reference[4*n], *qz = &reference[5*n], *qw = &reference[6*n];
+		for (int b = 0; b < n; b++)
+		{
+			// Difference rotation (reference inverse times sample), scaled from identity by weight (nlerp)
+			float dx = qw[b]*sx[b] - qx[b]*sw[b] - qy[b]*sz[b] + qz[b]*sy[b];
+			float dy = qw[b]*sy[b] - qy[b]*sw[b] - qz[b]*sx[b] + qx[b]*sz[b];
+			float dz = qw[b]*sz[b] - qz[b]*sw[b] - qx[b]*sy[b] + qy[b]*sx[b];
+			float dw = qw[b]*sw[b] + qx[b]*sx[b] + qy[b]*sy[b] + qz[b]*sz[b];
+			float sign = (dw < 0.0f)? -weight : weight;
+			dx *= sign; dy *= sign; dz *= sign;
+			dw = dw*sign + (1.0f - weight);
+			// Pose rotation times difference rotation
+			float x = rw[b]*dx + rx[b]*dw + ry[b]*dz - rz[b]*dy;
+			float y = rw[b]*dy + ry[b]*dw + rz[b]*dx - rx[b]*dz;
+			float z = rw[b]*dz + rz[b]*dw + rx[b]*dy - ry[b]*dx;
+			float w = rw[b]*dw - rx[b]*dx - ry[b]*dy - rz[b]*dz;
+			rx[b] = x; ry[b] = y; rz[b] = z; rw[b] = w;
+		}
+		NormalizePoseRotations(c, n);
+	}
+}
+
+// Update animated vertex data of several models from their blended poses
+// NOTE: Pose local transforms are concatenated to parents with model bones hierarchy
+void UpdateModelAnimationPoses(Model *models, AnimationPose *poses, int count)
+{
+	if (count <= 0) return;
+	int poseSize = 0;
+	for (int i = 0; i < count; i++) if (poses[i].components != NULL) poseSize += poses[i].boneCount;
+	if (poseSize == 0) return;
+	if (!animationWorkers.started && (count > 1)) SetAnimationWorkers(ANIMATION_WORKERS_DEFAULT);
+	BeginProfileScope("UpdateModelAnimationPoses");
+	Transform **globalPoses = (Transform **)calloc(count, sizeof(Transform *));
+	int *boneCounts = (int *)calloc(count, sizeof(int));
+	Transform *scratch = (Transform *)malloc(poseSize*sizeof(Transform));
+	if ((globalPoses == NULL) || (boneCounts == NULL) || (scratch == NULL))
+	{
+		debugNetPrintf(ERROR, "[ORBISGL] %s Animation poses could not be allocated\n",__FUNCTION__);
+		free(globalPoses);
+		free(boneCounts);
+		free(scratch);
+		EndProfileScope();
+		return;
+	}
+	Transform *pose = scratch;
+	for (int i = 0; i < count; i++)
+	{
+		int n = poses[i].boneCount;
+		if ((poses[i].components == NULL) || (models[i].bones == NULL)) continue;
+		boneCounts[i] = (n < models[i].boneCount)? n : models[i].boneCount;
+		const float *c = poses[i].components;
+		for (int b = 0; b < boneCounts[i]; b++)
 		{
-			Vector3 animVertex = { 0 };
-			Vector3 animNormal = { 0 };
-			Vector3 inTranslation = { 0 };
-			Quaternion inRotation = { 0 };
-			Vector3 inScale = { 0 };
-			Vector3 outTranslation = { 0 };
-			Quaternion outRotation = { 0 };
-			Vector3 outScale = { 0 };
-			int vCounter = 0;
-			int boneCounter = 0;
-			int boneId = 0;
-			for (int i = 0; i < model.meshes[m].vertexCount; i++)
+			pose[b].translation = (Vector3){ c[b], c[n + b], c[2*n + b] };
+			pose[b].rotation = (Quaternion){ c[3*n + b], c[4*n + b], c[5*n + b], c[6*n + b] };
+			pose[b].scale = (Vector3){ c[7*n + b], c[8*n + b], c[9*n + b] };
+			int parent = models[i].bones[b].parent;
+			if ((parent >= 0) && (parent < b))
 			{
-				boneId = model.meshes[m].boneIds[boneCounter];
-				inTranslation = model.bindPose[boneId].translation;
-				inRotation = model.bindPose[boneId].rotation;
-				inScale = model.bindPose[boneId].scale;
-				outTranslation = anim.framePoses[frame][boneId].translation;
-				outRotation = anim.framePoses[frame][boneId].rotation;
-				outScale = anim.framePoses[frame][boneId].scale;
-				// Vertices processing
-				// NOTE: We use meshes.vertices (default vertex position) to calculate meshes.animVertices (animated vertex position)
-				animVertex = (Vector3){ model.meshes[m].vertices[vCounter], model.meshes[m].vertices[vCounter + 1], model.meshes[m].vertices[vCounter + 2] };
-				animVertex = Vector3Multiply(animVertex, outScale);
-				animVertex = Vector3Subtract(animVertex, inTranslation);
-				animVertex = Vector3RotateByQuaternion(animVertex, QuaternionMultiply(outRotation, QuaternionInvert(inRotation)));
-				animVertex = Vector3Add(animVertex, outTranslation);
-				model.meshes[m].animVertices[vCounter] = animVertex.x;
-				model.meshes[m].animVertices[vCounter + 1] = animVertex.y;
-				model.meshes[m].animVertices[vCounter + 2] = animVertex.z;
-				// Normals processing
-				// NOTE: We use meshes.baseNormals (default normal) to calculate meshes.normals (animated normals)
-				animNormal = (Vector3){ model.meshes[m].normals[vCounter], model.meshes[m].normals[vCounter + 1], model.meshes[m].normals[vCounter + 2] };
-				animNormal = Vector3RotateByQuaternion(animNormal, QuaternionMultiply(outRotation, QuaternionInvert(inRotation)));
-				model.meshes[m].animNormals[vCounter] = animNormal.x;
-				model.meshes[m].animNormals[vCounter + 1] = animNormal.y;
-				model.meshes[m].animNormals[vCounter + 2] = animNormal.z;
-				vCounter += 3;
-				boneCounter += 4;
+				pose[b].rotation = QuaternionMultiply(pose[parent].rotation, pose[b].rotation);
+				pose[b].translation = Vector3Add(Vector3RotateByQuaternion(pose[b].translation, pose[parent].rotation), pose[parent].translation);
+				pose[b].scale = Vector3Multiply(pose[b].scale, pose[parent].scale);
 			}
-			// Upload new vertex data to GPU for model drawing
-			rlUpdateBuffer(model.meshes[m].vboId[0], model.meshes[m].animVertices, model.meshes[m].vertexCount*3*sizeof(float));    // Update vertex position
-			rlUpdateBuffer(model.meshes[m].vboId[2], model.meshes[m].animNormals, model.meshes[m].vertexCount*3*sizeof(float));     // Update vertex normals
 		}
+		globalPoses[i] = pose;
+		pose += n;
 	}
+	SkinModels(models, globalPoses, boneCounts, count);
+	free(globalPoses);
+	free(boneCounts);
+	free(scratch);
+	EndProfileScope();
 }
 
 // Unload animation data
 void UnloadModelAnimation(ModelAnimation anim)
 {
-	for (int i = 0; i < anim.frameCount; i++) free(anim.framePoses[i]);
+	if (anim.framePoses != NULL) for (int i = 0; i < anim.frameCount; i++) free(anim.framePoses[i]);
 	free(anim.bones);
 	free(anim.framePoses);
+	free(anim.channels);
 }
 
 // Check model animation skeleton match
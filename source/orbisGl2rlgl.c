@@ -64,12 +64,260 @@
 *
 **********************************************************************************************/
 
+#include <stdio.h>
 #include <stdlib.h>
+#include <stddef.h>
 #include <string.h>
 #include <debugnet.h>
 #include <fcntl.h>
 #include <orbisGl2.h>
 #include <orbisNfs.h>
+#include <pthread.h>
+#if defined(__SSE__)
+    #include <xmmintrin.h>
+#elif defined(__ARM_NEON)
+    #include <arm_neon.h>
+#endif
+
+#define RL_STATE_UNKNOWN    0xFFFFFFFF      // Cached GL state not known, next call is always issued
+
+#define RENDER_LIST_COMMANDS      1024      // Initial commands capacity of a render thread command list
+#define RENDER_LIST_DATA    (256*1024)      // Initial payload capacity of a render thread command list
+
+// Render thread command types
+typedef enum {
+	RC_BATCH = 0,           // Default batch vertex data and draws
+	RC_MESH,                // Mesh draw (rlDrawMesh())
+	RC_LIST,                // Display list draw (rlDrawList())
+	RC_UNIFORM,             // Shader uniform value
+	RC_UNIFORM_MATRIX,      // Shader uniform matrix
+	RC_TEXTURE_UPDATE,      // Texture rectangle pixels update
+	RC_BUFFER_UPDATE,       // Vertex buffer data update
+	RC_CLEAR_COLOR,
+	RC_CLEAR,
+	RC_VIEWPORT,
+	RC_SCISSOR,
+	RC_FRAMEBUFFER,
+	RC_CAPABILITY,
+	RC_BLEND_MODE,
+	RC_SWAP                 // Frame end, swap buffers
+} RenderCommandType;
+
+// Render thread command, payload (if any) is stored in list data
+typedef struct RenderCommand {
+	int type;
+	int params[6];
+	int dataOffset;
+	int dataSize;
+} RenderCommand;
+
+// Render thread command list, recorded by game thread and executed by render thread
+typedef struct RenderCommandList {
+	RenderCommand *commands;
+	int commandsCount;
+	int commandsCapacity;
+	unsigned char *data;
+	int dataSize;
+	int dataCapacity;
+} RenderCommandList;
+
+// Mesh draw payload, material pointers are fixed up on execution
+typedef struct MeshCommand {
+	Mesh mesh;
+	Material material;
+	MaterialMap maps[MAX_MATERIAL_MAPS];
+	int locs[MAX_SHADER_LOCATIONS];
+	Matrix matModel;
+	Matrix matView;
+	Matrix matProjection;
+	Matrix matMVP;
+} MeshCommand;
+
+// Render thread state
+// NOTE: Game thread records into lists[recording] while render thread executes pending list,
+// EGL context is moved to game thread on demand for immediate GL work (see RenderThreadAcquireContext())
+static struct {
+	bool enabled;
+	pthread_t thread;
+	pthread_mutex_t lock;
+	pthread_cond_t cond;
+	RenderCommandList lists[2];
+	int recording;                  // List being recorded by game thread
+	RenderCommandList *pending;     // List submitted and not executed yet
+	bool contextRequest;            // Game thread waits for EGL context
+	bool gameContext;               // EGL context is current on game thread
+	bool quit;
+	int renderBuffer;               // Default batch buffer used next by render thread
+	FrameStats cacheStats;          // State cache stats of last frame executed (render thread)
+	FrameStats lastCacheStats;      // Copy taken by game thread on submit
+} renderThread = { 0 };
+static __thread bool renderThreadSelf = false;
+
+static RenderCommand *RenderThreadPush(int type, const void *data, int dataSize);   // Record command on game thread list (payload copied)
+static void RenderThreadPushParams(int type, int p0, int p1, int p2, int p3);       // Record command with integer parameters
+static void RenderThreadSubmit(void);                                               // Submit recorded commands to render thread
+static void *RenderThreadMain(void *arg);                                           // Render thread main loop
+static void UnloadRenderThread(void);                                               // Unload render thread lists and sync objects
+
+#define THREAD_BATCH_VERTICES   4096    // Initial vertex capacity of a thread batch (grows on demand)
+#define THREAD_BATCH_DRAWS        64    // Initial draws capacity of a thread batch (grows on demand)
+
+// Thread batch, rl* vertex submissions of one thread recorded apart from default batch
+// NOTE: Vertex are stored transformed, draws are merged into default batch at rlglDraw()
+typedef struct ThreadBatch {
+	int key;                        // Merge order key (lower keys first)
+	unsigned int sequence;          // Submission order, used for same keys
+	DynamicBuffer buffer;           // Vertex data (only vertices and counters used)
+	int capacity;                   // Vertex capacity of buffer
+	DrawCall *draws;                // Draws registry
+	int drawsCounter;
+	int drawsCapacity;
+	Shader currentShader;
+	int currentBlendMode;
+	float currentDepth;
+	Matrix transform;               // Transform applied to vertex (rlPushMatrix()/rlTranslatef()...)
+	Matrix stack[MAX_MATRIX_STACK_SIZE];
+	int stackCounter;
+	bool doTransform;
+	struct ThreadBatch *next;
+} ThreadBatch;
+
+static struct {
+	pthread_mutex_t lock;
+	ThreadBatch *ready;             // Ended batches waiting for merge
+	ThreadBatch *unused;            // Merged batches kept for reuse
+	unsigned int sequence;
+} threadBatches = { PTHREAD_MUTEX_INITIALIZER };
+static __thread ThreadBatch *threadBatch = NULL;    // Batch recording rl* submissions of calling thread
+
+static void ThreadBatchNextDraw(ThreadBatch *batch);                                // Close current draw, following vertex go to a new one
+static bool ThreadBatchGrow(ThreadBatch *batch, int count);                         // Make room for count more vertex/texcoords/colors
+static BatchVertex *ThreadBatchReserve(ThreadBatch *batch, int count);              // Reserve room for count vertex
+static void ThreadBatchCommit(ThreadBatch *batch, int count);                       // Commit count vertex written on reserved room
+static void ThreadBatchEnd(ThreadBatch *batch);                                     // Finish vertex providing (rlEnd())
+static void MergeThreadBatches(void);                                               // Merge ended thread batches into default batch
+static void UnloadThreadBatches(void);                                              // Unload thread batches memory
+
+#define UNIFORM_MATRIX               -1     // Uniform type for matrix uploads (SetShaderValueMatrix())
+#define UNIFORM_CACHE_VALUE_SIZE     64     // Largest uniform value cached (one matrix), bigger arrays always upload
+#define UNIFORM_CACHE_CAPACITY      256     // Initial capacity of uniform tables (grow on demand)
+
+// Uniform location of a program by name
+typedef struct UniformName {
+	unsigned int program;           // Program id (0 means empty slot)
+	unsigned int hash;              // Name hash
+	char *name;
+	int location;
+} UniformName;
+
+// Last value uploaded to a uniform location of a program
+typedef struct UniformValue {
+	unsigned int program;           // Program id (0 means empty slot)
+	int location;
+	int type;
+	int size;                       // Value size in bytes (-1 means unknown value)
+	unsigned char value[UNIFORM_CACHE_VALUE_SIZE];
+} UniformValue;
+
+// Uniform tables, hashed by program and name/location (open addressing)
+// NOTE: Values are owned by the thread executing GL calls (as RLGL.Cache), names by game thread
+static struct {
+	UniformName *names;
+	int namesCount;
+	int namesCapacity;
+	UniformValue *values;
+	int valuesCount;
+	int valuesCapacity;
+} uniformCache = { 0 };
+
+#define PROGRAM_BINARY_MAGIC   0x4e494250   // "PBIN", program binary cache file tag
+#define PROGRAM_BINARY_VERSION          1   // Program binary cache file layout version
+
+// Program binary cache file header, followed by driver binary data
+typedef struct ProgramBinaryHeader {
+	unsigned int magic;
+	unsigned int version;
+	unsigned int format;            // Driver binary format (glGetProgramBinary())
+	int length;                     // Binary data length in bytes
+	unsigned long long key;         // Sources and driver hash (collision check)
+} ProgramBinaryHeader;
+
+// Uniform value shared by shader variants
+typedef struct VariantUniform {
+	char *name;                     // Uniform name, location is queried per variant
+	int type;                       // Uniform type (ShaderUniformDataType)
+	int count;                      // Number of elements
+	void *value;                    // Uniform value data
+} VariantUniform;
+
+// Uniform values of shader variants, set on variants compiled later
+struct ShaderVariantsUniforms {
+	VariantUniform *values;
+	int count;
+	int capacity;
+};
+
+static char *shaderCacheDirectory = NULL;           // Program binaries cache directory (NULL means disabled)
+static ShaderVariants defaultVariants = { 0 };      // Default shader variants (GPU skinning of meshes drawn with default shader)
+
+static int GetUniformTypeSize(int uniformType);                                     // Get size of one uniform element of a type
+static unsigned long long HashProgramSources(const char *vsCode, const char *fsCode);  // Hash program sources with driver version and renderer
+static void GetProgramBinaryPath(unsigned long long key, char *path, int size);     // Get cache file path of a program binary
+static char *LoadShaderVariantCode(const char *code, unsigned int features);         // Get shader code with features defines injected
+static void FlushShaderDraws(unsigned int shaderId);                                // Flush pending draws of shader (game thread only)
+
+// Shader feature defines, by feature bit
+static const char *shaderFeatureDefines[] = { "USE_VERTEX_COLOR", "USE_NORMAL_MAP", "USE_SPECULAR_MAP", "USE_SKINNING", "USE_FOG" };
+static void EndFrameCached(void);                                                   // Move state cache counters to last frame ones
+static void GetFrameStatsCached(FrameStats *stats);                                 // Get state cache counters of last frame
+
+// Vertex shader directly defined, no external file required
+// NOTE: USE_SKINNING variant skins position and normal with up to 4 bone matrices (3 rows by bone),
+// custom shaders providing USE_SKINNING are expected to skin them the same way
+static const char *defaultVShaderCode =
+"#version 100                       \n"
+"attribute vec3 vertexPosition;     \n"
+"attribute vec2 vertexTexCoord;     \n"
+"attribute vec4 vertexColor;        \n"
+"#ifdef USE_SKINNING                \n"
+"attribute vec3 vertexNormal;       \n"
+"attribute vec4 vertexBoneIds;      \n"
+"attribute vec4 vertexBoneWeights;  \n"
+"uniform vec4 boneMatrices[MAX_SKINNING_BONES*3]; \n"
+"varying vec3 fragNormal;           \n"
+"#endif                             \n"
+"varying vec2 fragTexCoord;         \n"
+"varying vec4 fragColor;            \n"
+"uniform mat4 mvp;                  \n"
+"void main()                        \n"
+"{                                  \n"
+"    fragTexCoord = vertexTexCoord; \n"
+"    fragColor = vertexColor;       \n"
+"    vec4 position = vec4(vertexPosition, 1.0); \n"
+"#ifdef USE_SKINNING                \n"
+"    ivec4 ids = ivec4(vertexBoneIds)*3; \n"
+"    vec4 w = vertexBoneWeights;    \n"
+"    vec4 row0 = boneMatrices[ids.x]*w.x + boneMatrices[ids.y]*w.y + boneMatrices[ids.z]*w.z + boneMatrices[ids.w]*w.w; \n"
+"    vec4 row1 = boneMatrices[ids.x + 1]*w.x + boneMatrices[ids.y + 1]*w.y + boneMatrices[ids.z + 1]*w.z + boneMatrices[ids.w + 1]*w.w; \n"
+"    vec4 row2 = boneMatrices[ids.x + 2]*w.x + boneMatrices[ids.y + 2]*w.y + boneMatrices[ids.z + 2]*w.z + boneMatrices[ids.w + 2]*w.w; \n"
+"    position = vec4(dot(row0, position), dot(row1, position), dot(row2, position), 1.0); \n"
+"    fragNormal = normalize(vec3(dot(row0.xyz, vertexNormal), dot(row1.xyz, vertexNormal), dot(row2.xyz, vertexNormal))); \n"
+"#endif                             \n"
+"    gl_Position = mvp*position;    \n"
+"}                                  \n";
+// Fragment shader directly defined, no external file required
+static const char *defaultFShaderCode =
+"#version 100                       \n"
+"precision mediump float;           \n"     // precision required for OpenGL ES2 (WebGL)
+"varying vec2 fragTexCoord;         \n"
+"varying vec4 fragColor;            \n"
+"uniform sampler2D texture0;        \n"
+"uniform vec4 colDiffuse;           \n"
+"void main()                        \n"
+"{                                  \n"
+"    vec4 texelColor = texture2D(texture0, fragTexCoord); \n" // NOTE: texture2D() is deprecated on OpenGL 3.3 and ES 3.0
+"    gl_FragColor = texelColor*colDiffuse*fragColor;      \n"
+"}                                  \n";
 
 extern rlglData RLGL;
 
@@ -78,10 +326,39 @@ extern rlglData RLGL;
 // Module Functions Definition - Matrix operations
 //----------------------------------------------------------------------------------
 
+// Invalidate cached matrix products after current matrix changed
+static void rlMatrixChanged(void)
+{
+	RLGL.State.meshViewProjectionDirty = true;
+	if (RLGL.State.currentMatrix != &RLGL.State.transform) RLGL.State.viewProjectionDirty = true;
+}
+
+// Get modelview*projection product, recomputed only if matrices changed
+static Matrix GetViewProjection(void)
+{
+	if (RLGL.State.viewProjectionDirty)
+	{
+		RLGL.State.viewProjection = MatrixMultiply(RLGL.State.modelview, RLGL.State.projection);
+		RLGL.State.viewProjectionDirty = false;
+	}
+	return RLGL.State.viewProjection;
+}
+
+// Get transform*modelview*projection product, recomputed only if matrices changed
+static Matrix GetMeshViewProjection(void)
+{
+	if (RLGL.State.meshViewProjectionDirty)
+	{
+		RLGL.State.meshViewProjection = MatrixMultiply(RLGL.State.transform, GetViewProjection());
+		RLGL.State.meshViewProjectionDirty = false;
+	}
+	return RLGL.State.meshViewProjection;
+}
 
 // Choose the current matrix to be transformed
 void rlMatrixMode(int mode)
 {
+	if (threadBatch != NULL) return;    // Thread batches only have a transform matrix
 	if (mode == RL_PROJECTION) RLGL.State.currentMatrix = &RLGL.State.projection;
 	else if (mode == RL_MODELVIEW) RLGL.State.currentMatrix = &RLGL.State.modelview;
 	//else if (mode == RL_TEXTURE) // Not supported
@@ -91,12 +368,19 @@ void rlMatrixMode(int mode)
 // Push the current matrix into RLGL.State.stack
 void rlPushMatrix(void)
 {
+	if (threadBatch != NULL)
+	{
+		if (threadBatch->stackCounter < MAX_MATRIX_STACK_SIZE) threadBatch->stack[threadBatch->stackCounter++] = threadBatch->transform;
+		else debugNetPrintf(ERROR, "[ORBISGL] %s Thread batch matrix stack overflow\n",__FUNCTION__);
+		return;
+	}
 	if (RLGL.State.stackCounter >= MAX_MATRIX_STACK_SIZE) debugNetPrintf(ERROR, "[ORBISGL] %s Matrix RLGL.State.stack overflow\n",__FUNCTION__);
 	if (RLGL.State.currentMatrixMode == RL_MODELVIEW)
 	{
 		RLGL.State.doTransform = true;
 		RLGL.State.currentMatrix = &RLGL.State.transform;
 	}
+	RLGL.State.transformDirty = true;
 
 	RLGL.State.stack[RLGL.State.stackCounter] = *RLGL.State.currentMatrix;
 	RLGL.State.stackCounter++;
@@ -105,11 +389,18 @@ void rlPushMatrix(void)
 // Pop lattest inserted matrix from RLGL.State.stack
 void rlPopMatrix(void)
 {
+	if (threadBatch != NULL)
+	{
+		if (threadBatch->stackCounter > 0) threadBatch->transform = threadBatch->stack[--threadBatch->stackCounter];
+		return;
+	}
 	if (RLGL.State.stackCounter > 0)
 	{
 		Matrix mat = RLGL.State.stack[RLGL.State.stackCounter - 1];
 		*RLGL.State.currentMatrix = mat;
 		RLGL.State.stackCounter--;
+		RLGL.State.transformDirty = true;
+		rlMatrixChanged();
 	}
 	if ((RLGL.State.stackCounter == 0) && (RLGL.State.currentMatrixMode == RL_MODELVIEW))
 	{
@@ -121,15 +412,31 @@ void rlPopMatrix(void)
 // Reset current matrix to identity matrix
 void rlLoadIdentity(void)
 {
+	if (threadBatch != NULL)
+	{
+		threadBatch->transform = MatrixIdentity();
+		threadBatch->doTransform = false;
+		return;
+	}
 	*RLGL.State.currentMatrix = MatrixIdentity();
+	RLGL.State.transformDirty = true;
+	rlMatrixChanged();
 }
 
 // Multiply the current matrix by a translation matrix
 void rlTranslatef(float x, float y, float z)
 {
 	Matrix matTranslation = MatrixTranslate(x, y, z);
+	if (threadBatch != NULL)
+	{
+		threadBatch->transform = MatrixMultiply(matTranslation, threadBatch->transform);
+		threadBatch->doTransform = true;
+		return;
+	}
 	// NOTE: We transpose matrix with multiplication order
 	*RLGL.State.currentMatrix = MatrixMultiply(matTranslation, *RLGL.State.currentMatrix);
+	RLGL.State.transformDirty = true;
+	rlMatrixChanged();
 }
 
 // Multiply the current matrix by a rotation matrix
@@ -138,16 +445,32 @@ void rlRotatef(float angleDeg, float x, float y, float z)
 	Matrix matRotation = MatrixIdentity();
 	Vector3 axis = (Vector3){ x, y, z };
 	matRotation = MatrixRotate(Vector3Normalize(axis), angleDeg*DEG2RAD);
+	if (threadBatch != NULL)
+	{
+		threadBatch->transform = MatrixMultiply(matRotation, threadBatch->transform);
+		threadBatch->doTransform = true;
+		return;
+	}
 	// NOTE: We transpose matrix with multiplication order
 	*RLGL.State.currentMatrix = MatrixMultiply(matRotation, *RLGL.State.currentMatrix);
+	RLGL.State.transformDirty = true;
+	rlMatrixChanged();
 }
 
 // Multiply the current matrix by a scaling matrix
 void rlScalef(float x, float y, float z)
 {
 	Matrix matScale = MatrixScale(x, y, z);
+	if (threadBatch != NULL)
+	{
+		threadBatch->transform = MatrixMultiply(matScale, threadBatch->transform);
+		threadBatch->doTransform = true;
+		return;
+	}
 	// NOTE: We transpose matrix with multiplication order
 	*RLGL.State.currentMatrix = MatrixMultiply(matScale, *RLGL.State.currentMatrix);
+	RLGL.State.transformDirty = true;
+	rlMatrixChanged();
 }
 
 // Multiply the current matrix by another matrix
@@ -158,7 +481,15 @@ void rlMultMatrixf(float *matf)
 				matf[1], matf[5], matf[9], matf[13],
 				matf[2], matf[6], matf[10], matf[14],
 				matf[3], matf[7], matf[11], matf[15]};
+	if (threadBatch != NULL)
+	{
+		threadBatch->transform = MatrixMultiply(threadBatch->transform, mat);
+		threadBatch->doTransform = true;
+		return;
+	}
 	*RLGL.State.currentMatrix = MatrixMultiply(*RLGL.State.currentMatrix, mat);
+	RLGL.State.transformDirty = true;
+	rlMatrixChanged();
 }
 
 // Multiply the current matrix by a perspective matrix generated by parameters
@@ -166,6 +497,7 @@ void rlFrustum(double left, double right, double bottom, double top, double znea
 {
 	Matrix matPerps = MatrixFrustum(left, right, bottom, top, znear, zfar);
 	*RLGL.State.currentMatrix = MatrixMultiply(*RLGL.State.currentMatrix, matPerps);
+	rlMatrixChanged();
 }
 
 // Multiply the current matrix by an orthographic matrix generated by parameters
@@ -173,6 +505,7 @@ void rlOrtho(double left, double right, double bottom, double top, double znear,
 {
 	Matrix matOrtho = MatrixOrtho(left, right, bottom, top, znear, zfar);
 	*RLGL.State.currentMatrix = MatrixMultiply(*RLGL.State.currentMatrix, matOrtho);
+	rlMatrixChanged();
 }
 
 
@@ -180,7 +513,8 @@ void rlOrtho(double left, double right, double bottom, double top, double znear,
 // NOTE: Updates global variables: RLGL.State.framebufferWidth, RLGL.State.framebufferHeight
 void rlViewport(int x, int y, int width, int height)
 {
-	glViewport(x, y, width, height);
+	if (RenderThreadRecording()) RenderThreadPushParams(RC_VIEWPORT, x, y, width, height);
+	else glViewport(x, y, width, height);
 }
 
 //----------------------------------------------------------------------------------
@@ -188,38 +522,98 @@ void rlViewport(int x, int y, int width, int height)
 //----------------------------------------------------------------------------------
 
 
+// Start a new deferred transform span at current vertex (if transform is enabled)
+// NOTE: Vertex are stored untransformed, TransformBuffersDefault() applies spans at flush
+static void rlUpdateTransformSpan(void)
+{
+	int vCounter = RLGL.State.vertexData[RLGL.State.currentBuffer].vCounter;
+	if (RLGL.State.transformSpanActive)
+	{
+		TransformSpan *span = &RLGL.State.transformSpans[RLGL.State.transformSpansCounter - 1];
+		span->vertexCount = vCounter - span->firstVertex;
+		if (span->vertexCount <= 0) RLGL.State.transformSpansCounter--;
+		RLGL.State.transformSpanActive = false;
+	}
+	if (RLGL.State.doTransform)
+	{
+		// Spans array full: apply pending transforms right now
+		if (RLGL.State.transformSpansCounter >= RLGL.State.batchElements) TransformBuffersDefault();
+		RLGL.State.transformSpans[RLGL.State.transformSpansCounter].firstVertex = vCounter;
+		RLGL.State.transformSpans[RLGL.State.transformSpansCounter].vertexCount = 0;
+		RLGL.State.transformSpans[RLGL.State.transformSpansCounter].transform = RLGL.State.transform;
+		RLGL.State.transformSpansCounter++;
+		RLGL.State.transformSpanActive = true;
+	}
+	RLGL.State.transformDirty = false;
+}
+
+// Get number of vertex required to align a draw vertexCount to a multiple of 4
+static int rlDrawAlignment(const DrawCall *draw)
+{
+	if (draw->mode == RL_LINES) return ((draw->vertexCount < 4)? draw->vertexCount : draw->vertexCount%4);
+	else if (draw->mode == RL_TRIANGLES) return ((draw->vertexCount < 4)? 1 : (4 - (draw->vertexCount%4)));
+	return 0;
+}
+
+// Check if two draws share all state (texture, mode, shader and blending mode)
+static bool rlDrawsMergeable(const DrawCall *a, const DrawCall *b)
+{
+	return ((a->textureId == b->textureId) && (a->mode == b->mode) && (a->shader.id == b->shader.id) && (a->blendMode == b->blendMode));
+}
+
+// Close current draw registry entry (if it has vertex), following vertex go to a new entry
+static void rlNextDrawCall(void)
+{
+	if (RLGL.State.draws[RLGL.State.drawsCounter - 1].vertexCount > 0)
+	{
+		// Make sure current RLGL.State.draws[i].vertexCount is aligned a multiple of 4,
+		// that way, following QUADS drawing will keep aligned with index processing
+		// It implies adding some extra alignment vertex at the end of the draw,
+		// those vertex are not processed but they are considered as an additional offset
+		// for the next set of vertex to be drawn
+		RLGL.State.draws[RLGL.State.drawsCounter - 1].vertexAlignment = rlDrawAlignment(&RLGL.State.draws[RLGL.State.drawsCounter - 1]);
+		if (rlCheckBufferLimit(RLGL.State.draws[RLGL.State.drawsCounter - 1].vertexAlignment))
+		{
+			RLGL.State.flushCause = FLUSH_STATE_CHANGE;
+			rlglDraw();
+		}
+		else
+		{
+			RLGL.State.vertexData[RLGL.State.currentBuffer].vCounter += RLGL.State.draws[RLGL.State.drawsCounter - 1].vertexAlignment;
+			RLGL.State.vertexData[RLGL.State.currentBuffer].cCounter += RLGL.State.draws[RLGL.State.drawsCounter - 1].vertexAlignment;
+			RLGL.State.vertexData[RLGL.State.currentBuffer].tcCounter += RLGL.State.draws[RLGL.State.drawsCounter - 1].vertexAlignment;
+			RLGL.State.drawsCounter++;
+		}
+	}
+	if (RLGL.State.drawsCounter >= RLGL.State.maxDrawCalls)
+	{
+		RLGL.State.drawLimitFlushes++;
+		RLGL.State.flushCause = FLUSH_DRAW_LIMIT;
+		rlglDraw();
+	}
+	// Entry uses current shader and blending mode
+	RLGL.State.draws[RLGL.State.drawsCounter - 1].shader = RLGL.State.currentShader;
+	RLGL.State.draws[RLGL.State.drawsCounter - 1].blendMode = RLGL.State.currentBlendMode;
+}
+
 // Initialize drawing mode (how to organize vertex)
 void rlBegin(int mode)
 {
+	if (threadBatch != NULL)
+	{
+		if (threadBatch->draws[threadBatch->drawsCounter - 1].mode != mode)
+		{
+			ThreadBatchNextDraw(threadBatch);
+			threadBatch->draws[threadBatch->drawsCounter - 1].mode = mode;
+			threadBatch->draws[threadBatch->drawsCounter - 1].textureId = RLGL.State.defaultTextureId;
+		}
+		return;
+	}
 	// Draw mode can be RL_LINES, RL_TRIANGLES and RL_QUADS
     // NOTE: In all three cases, vertex are accumulated over default internal vertex buffer
     if (RLGL.State.draws[RLGL.State.drawsCounter - 1].mode != mode)
     {
-        if (RLGL.State.draws[RLGL.State.drawsCounter - 1].vertexCount > 0)
-        {
-            // Make sure current RLGL.State.draws[i].vertexCount is aligned a multiple of 4,
-            // that way, following QUADS drawing will keep aligned with index processing
-            // It implies adding some extra alignment vertex at the end of the draw,
-            // those vertex are not processed but they are considered as an additional offset
-            // for the next set of vertex to be drawn
-            if (RLGL.State.draws[RLGL.State.drawsCounter - 1].mode == RL_LINES) RLGL.State.draws[RLGL.State.drawsCounter - 1].vertexAlignment = ((RLGL.State.draws[RLGL.State.drawsCounter - 1].vertexCount < 4)? RLGL.State.draws[RLGL.State.drawsCounter - 1].vertexCount : RLGL.State.draws[RLGL.State.drawsCounter - 1].vertexCount%4);
-            else if (RLGL.State.draws[RLGL.State.drawsCounter - 1].mode == RL_TRIANGLES) RLGL.State.draws[RLGL.State.drawsCounter - 1].vertexAlignment = ((RLGL.State.draws[RLGL.State.drawsCounter - 1].vertexCount < 4)? 1 : (4 - (RLGL.State.draws[RLGL.State.drawsCounter - 1].vertexCount%4)));
-
-            else RLGL.State.draws[RLGL.State.drawsCounter - 1].vertexAlignment = 0;
-
-            if (rlCheckBufferLimit(RLGL.State.draws[RLGL.State.drawsCounter - 1].vertexAlignment)) rlglDraw();
-            else
-            {
-                RLGL.State.vertexData[RLGL.State.currentBuffer].vCounter += RLGL.State.draws[RLGL.State.drawsCounter - 1].vertexAlignment;
-                RLGL.State.vertexData[RLGL.State.currentBuffer].cCounter += RLGL.State.draws[RLGL.State.drawsCounter - 1].vertexAlignment;
-                RLGL.State.vertexData[RLGL.State.currentBuffer].tcCounter += RLGL.State.draws[RLGL.State.drawsCounter - 1].vertexAlignment;
-
-                RLGL.State.drawsCounter++;
-            }
-        }
-
-        if (RLGL.State.drawsCounter >= MAX_DRAWCALL_REGISTERED) rlglDraw();
-
+        rlNextDrawCall();
         RLGL.State.draws[RLGL.State.drawsCounter - 1].mode = mode;
         RLGL.State.draws[RLGL.State.drawsCounter - 1].vertexCount = 0;
         RLGL.State.draws[RLGL.State.drawsCounter - 1].textureId = RLGL.State.defaultTextureId;
@@ -229,6 +623,11 @@ void rlBegin(int mode)
 // Finish vertex providing
 void rlEnd(void)
 {
+	if (threadBatch != NULL)
+	{
+		ThreadBatchEnd(threadBatch);
+		return;
+	}
 	// Make sure vertexCount is the same for vertices, texcoords, colors and normals
 	// NOTE: In OpenGL 1.1, one glColor call can be made for all the subsequent glVertex calls
 	// Make sure colors count match vertex count
@@ -237,10 +636,13 @@ void rlEnd(void)
 		int addColors = RLGL.State.vertexData[RLGL.State.currentBuffer].vCounter - RLGL.State.vertexData[RLGL.State.currentBuffer].cCounter;
 		for (int i = 0; i < addColors; i++)
 		{
-			RLGL.State.vertexData[RLGL.State.currentBuffer].colors[4*RLGL.State.vertexData[RLGL.State.currentBuffer].cCounter] = RLGL.State.vertexData[RLGL.State.currentBuffer].colors[4*RLGL.State.vertexData[RLGL.State.currentBuffer].cCounter - 4];
-			RLGL.State.vertexData[RLGL.State.currentBuffer].colors[4*RLGL.State.vertexData[RLGL.State.currentBuffer].cCounter + 1] = RLGL.State.vertexData[RLGL.State.currentBuffer].colors[4*RLGL.State.vertexData[RLGL.State.currentBuffer].cCounter - 3];
-			RLGL.State.vertexData[RLGL.State.currentBuffer].colors[4*RLGL.State.vertexData[RLGL.State.currentBuffer].cCounter + 2] = RLGL.State.vertexData[RLGL.State.currentBuffer].colors[4*RLGL.State.vertexData[RLGL.State.currentBuffer].cCounter - 2];
-			RLGL.State.vertexData[RLGL.State.currentBuffer].colors[4*RLGL.State.vertexData[RLGL.State.currentBuffer].cCounter + 3] = RLGL.State.vertexData[RLGL.State.currentBuffer].colors[4*RLGL.State.vertexData[RLGL.State.currentBuffer].cCounter - 1];
+			// NOTE: First vertex of a buffer takes the color carried by last buffer full flush
+			BatchVertex *vertex = &RLGL.State.vertexData[RLGL.State.currentBuffer].vertices[RLGL.State.vertexData[RLGL.State.currentBuffer].cCounter];
+			const unsigned char *color = (RLGL.State.vertexData[RLGL.State.currentBuffer].cCounter > 0)? (vertex - 1)->color : RLGL.State.flushColor;
+			vertex->color[0] = color[0];
+			vertex->color[1] = color[1];
+			vertex->color[2] = color[2];
+			vertex->color[3] = color[3];
 			RLGL.State.vertexData[RLGL.State.currentBuffer].cCounter++;
 		}
 	}
@@ -250,8 +652,8 @@ void rlEnd(void)
 		int addTexCoords = RLGL.State.vertexData[RLGL.State.currentBuffer].vCounter - RLGL.State.vertexData[RLGL.State.currentBuffer].tcCounter;
 		for (int i = 0; i < addTexCoords; i++)
 		{
-			RLGL.State.vertexData[RLGL.State.currentBuffer].texcoords[2*RLGL.State.vertexData[RLGL.State.currentBuffer].tcCounter] = 0.0f;
-			RLGL.State.vertexData[RLGL.State.currentBuffer].texcoords[2*RLGL.State.vertexData[RLGL.State.currentBuffer].tcCounter + 1] = 0.0f;
+			RLGL.State.vertexData[RLGL.State.currentBuffer].vertices[RLGL.State.vertexData[RLGL.State.currentBuffer].tcCounter].texcoord[0] = 0.0f;
+			RLGL.State.vertexData[RLGL.State.currentBuffer].vertices[RLGL.State.vertexData[RLGL.State.currentBuffer].tcCounter].texcoord[1] = 0.0f;
 			RLGL.State.vertexData[RLGL.State.currentBuffer].tcCounter++;
 		}
 	}
@@ -262,12 +664,14 @@ void rlEnd(void)
 	RLGL.State.currentDepth += (1.0f/20000.0f);
 	// Verify internal buffers limits
 	// NOTE: This check is combined with usage of rlCheckBufferLimit()
-	if ((RLGL.State.vertexData[RLGL.State.currentBuffer].vCounter) >= (MAX_BATCH_ELEMENTS*4 - 4))
+	if ((RLGL.State.vertexData[RLGL.State.currentBuffer].vCounter) >= (RLGL.State.batchElements*4 - 4))
 	{
+		RLGL.State.batchLimitFlushes++;
 		// WARNING: If we are between rlPushMatrix() and rlPopMatrix() and we need to force a rlglDraw(),
 		// we need to call rlPopMatrix() before to recover *RLGL.State.currentMatrix (RLGL.State.modelview) for the next forced draw call!
 		// If we have multiple matrix pushed, it will require "RLGL.State.stackCounter" pops before launching the draw
 		for (int i = RLGL.State.stackCounter; i >= 0; i--) rlPopMatrix();
+		RLGL.State.flushCause = FLUSH_BUFFER_FULL;
 		rlglDraw();
 	}
 }
@@ -276,39 +680,58 @@ void rlEnd(void)
 // NOTE: Vertex position data is the basic information required for drawing
 void rlVertex3f(float x, float y, float z)
 {
-	Vector3 vec = { x, y, z };
-	// Transform provided vector if required
-	if (RLGL.State.doTransform) vec = Vector3Transform(vec, RLGL.State.transform);
-	// Verify that MAX_BATCH_ELEMENTS limit not reached
-	if (RLGL.State.vertexData[RLGL.State.currentBuffer].vCounter < (MAX_BATCH_ELEMENTS*4))
+	if (threadBatch != NULL)
+	{
+		if (!ThreadBatchGrow(threadBatch, 1)) return;
+		Vector3 position = { x, y, z };
+		if (threadBatch->doTransform) position = Vector3Transform(position, threadBatch->transform);
+		memcpy(threadBatch->buffer.vertices[threadBatch->buffer.vCounter].position, &position, sizeof(float)*3);
+		threadBatch->buffer.vCounter++;
+		threadBatch->draws[threadBatch->drawsCounter - 1].vertexCount++;
+		return;
+	}
+	// Transform is deferred to flush, just track transform changes
+	if (RLGL.State.transformDirty) rlUpdateTransformSpan();
+	// Batch full in the middle of a primitive: flush it and carry the unfinished primitive over
+	if (RLGL.State.vertexData[RLGL.State.currentBuffer].vCounter >= (RLGL.State.batchElements*4)) FlushBuffersDefault();
+	if (RLGL.State.vertexData[RLGL.State.currentBuffer].vCounter < (RLGL.State.batchElements*4))
 	{
-		RLGL.State.vertexData[RLGL.State.currentBuffer].vertices[3*RLGL.State.vertexData[RLGL.State.currentBuffer].vCounter] = vec.x;
-		RLGL.State.vertexData[RLGL.State.currentBuffer].vertices[3*RLGL.State.vertexData[RLGL.State.currentBuffer].vCounter + 1] = vec.y;
-		RLGL.State.vertexData[RLGL.State.currentBuffer].vertices[3*RLGL.State.vertexData[RLGL.State.currentBuffer].vCounter + 2] = vec.z;
+		RLGL.State.vertexData[RLGL.State.currentBuffer].vertices[RLGL.State.vertexData[RLGL.State.currentBuffer].vCounter].position[0] = x;
+		RLGL.State.vertexData[RLGL.State.currentBuffer].vertices[RLGL.State.vertexData[RLGL.State.currentBuffer].vCounter].position[1] = y;
+		RLGL.State.vertexData[RLGL.State.currentBuffer].vertices[RLGL.State.vertexData[RLGL.State.currentBuffer].vCounter].position[2] = z;
 		RLGL.State.vertexData[RLGL.State.currentBuffer].vCounter++;
 		RLGL.State.draws[RLGL.State.drawsCounter - 1].vertexCount++;
 	}
-	else debugNetPrintf(ERROR,"[ORBISGL] %s MAX_BATCH_ELEMENTS overflow\n",__FUNCTION__);
+	else debugNetPrintf(ERROR,"[ORBISGL] %s batch overflow, vertex dropped\n",__FUNCTION__);
 }
 
 // Define one vertex (position)
 void rlVertex2f(float x, float y)
 {
-	rlVertex3f(x, y, RLGL.State.currentDepth);
+	rlVertex3f(x, y, GetBatchDepth());
 }
 
 // Define one vertex (position)
 void rlVertex2i(int x, int y)
 {
-	rlVertex3f((float)x, (float)y, RLGL.State.currentDepth);
+	rlVertex3f((float)x, (float)y, GetBatchDepth());
 }
 
 // Define one vertex (texture coordinate)
 // NOTE: Texture coordinates are limited to QUADS only
 void rlTexCoord2f(float x, float y)
 {
-	RLGL.State.vertexData[RLGL.State.currentBuffer].texcoords[2*RLGL.State.vertexData[RLGL.State.currentBuffer].tcCounter] = x;
-	RLGL.State.vertexData[RLGL.State.currentBuffer].texcoords[2*RLGL.State.vertexData[RLGL.State.currentBuffer].tcCounter + 1] = y;
+	if (threadBatch != NULL)
+	{
+		if (!ThreadBatchGrow(threadBatch, 1)) return;
+		threadBatch->buffer.vertices[threadBatch->buffer.tcCounter].texcoord[0] = x;
+		threadBatch->buffer.vertices[threadBatch->buffer.tcCounter].texcoord[1] = y;
+		threadBatch->buffer.tcCounter++;
+		return;
+	}
+	if (RLGL.State.vertexData[RLGL.State.currentBuffer].tcCounter >= (RLGL.State.batchElements*4)) FlushBuffersDefault();
+	RLGL.State.vertexData[RLGL.State.currentBuffer].vertices[RLGL.State.vertexData[RLGL.State.currentBuffer].tcCounter].texcoord[0] = x;
+	RLGL.State.vertexData[RLGL.State.currentBuffer].vertices[RLGL.State.vertexData[RLGL.State.currentBuffer].tcCounter].texcoord[1] = y;
 	RLGL.State.vertexData[RLGL.State.currentBuffer].tcCounter++;
 }
 
@@ -322,10 +745,22 @@ void rlNormal3f(float x, float y, float z)
 // Define one vertex (color)
 void rlColor4ub(byte x, byte y, byte z, byte w)
 {
-	RLGL.State.vertexData[RLGL.State.currentBuffer].colors[4*RLGL.State.vertexData[RLGL.State.currentBuffer].cCounter] = x;
-	RLGL.State.vertexData[RLGL.State.currentBuffer].colors[4*RLGL.State.vertexData[RLGL.State.currentBuffer].cCounter + 1] = y;
-	RLGL.State.vertexData[RLGL.State.currentBuffer].colors[4*RLGL.State.vertexData[RLGL.State.currentBuffer].cCounter + 2] = z;
-	RLGL.State.vertexData[RLGL.State.currentBuffer].colors[4*RLGL.State.vertexData[RLGL.State.currentBuffer].cCounter + 3] = w;
+	if (threadBatch != NULL)
+	{
+		if (!ThreadBatchGrow(threadBatch, 1)) return;
+		unsigned char *color = threadBatch->buffer.vertices[threadBatch->buffer.cCounter].color;
+		color[0] = x;
+		color[1] = y;
+		color[2] = z;
+		color[3] = w;
+		threadBatch->buffer.cCounter++;
+		return;
+	}
+	if (RLGL.State.vertexData[RLGL.State.currentBuffer].cCounter >= (RLGL.State.batchElements*4)) FlushBuffersDefault();
+	RLGL.State.vertexData[RLGL.State.currentBuffer].vertices[RLGL.State.vertexData[RLGL.State.currentBuffer].cCounter].color[0] = x;
+	RLGL.State.vertexData[RLGL.State.currentBuffer].vertices[RLGL.State.vertexData[RLGL.State.currentBuffer].cCounter].color[1] = y;
+	RLGL.State.vertexData[RLGL.State.currentBuffer].vertices[RLGL.State.vertexData[RLGL.State.currentBuffer].cCounter].color[2] = z;
+	RLGL.State.vertexData[RLGL.State.currentBuffer].vertices[RLGL.State.vertexData[RLGL.State.currentBuffer].cCounter].color[3] = w;
 	RLGL.State.vertexData[RLGL.State.currentBuffer].cCounter++;
 }
 
@@ -341,6 +776,109 @@ void rlColor3f(float x, float y, float z)
 	rlColor4ub((byte)(x*255), (byte)(y*255), (byte)(z*255), 255);
 }
 
+// Reserve room for up to count vertex on current draw, flushing batch if full
+// NOTE: Returned count keeps current draw primitive aligned when batch can not fit all
+static int rlReserveVertex(int count)
+{
+	DynamicBuffer *buffer = &RLGL.State.vertexData[RLGL.State.currentBuffer];
+	int primitive = (RLGL.State.draws[RLGL.State.drawsCounter - 1].mode == RL_QUADS)? 4 : ((RLGL.State.draws[RLGL.State.drawsCounter - 1].mode == RL_TRIANGLES)? 3 : 2);
+	int room = RLGL.State.batchElements*4 - buffer->vCounter;
+	if (count > room) count = room - (RLGL.State.draws[RLGL.State.drawsCounter - 1].vertexCount + room)%primitive;
+	if (count <= 0)
+	{
+		FlushBuffersDefault();
+		buffer = &RLGL.State.vertexData[RLGL.State.currentBuffer];
+		count = 0;
+	}
+	// Texcoords/colors lagging behind vertex are filled as rlEnd() does
+	for (; buffer->tcCounter < buffer->vCounter; buffer->tcCounter++)
+	{
+		buffer->vertices[buffer->tcCounter].texcoord[0] = 0.0f;
+		buffer->vertices[buffer->tcCounter].texcoord[1] = 0.0f;
+	}
+	for (; (buffer->cCounter > 0) && (buffer->cCounter < buffer->vCounter); buffer->cCounter++) memcpy(buffer->vertices[buffer->cCounter].color, buffer->vertices[buffer->cCounter - 1].color, 4);
+	return count;
+}
+
+// Commit count vertex written on current buffer to the current draw
+static void rlCommitVertex(int count)
+{
+	DynamicBuffer *buffer = &RLGL.State.vertexData[RLGL.State.currentBuffer];
+	if (RLGL.State.transformDirty) rlUpdateTransformSpan();
+	buffer->vCounter += count;
+	buffer->tcCounter = buffer->vCounter;
+	buffer->cCounter = buffer->vCounter;
+	RLGL.State.draws[RLGL.State.drawsCounter - 1].vertexCount += count;
+}
+
+// Define multiple vertex for current draw mode (between rlBegin()/rlEnd())
+// NOTE: If texcoords is NULL (0, 0) is used, if colors is NULL last color defined is used
+void rlVertexArray(const float *positions, const float *texcoords, const unsigned char *colors, int count)
+{
+	unsigned char color[4] = { 255, 255, 255, 255 };
+	DynamicBuffer *buffer = (threadBatch != NULL)? &threadBatch->buffer : &RLGL.State.vertexData[RLGL.State.currentBuffer];
+	if ((colors == NULL) && (buffer->cCounter > 0)) memcpy(color, buffer->vertices[buffer->cCounter - 1].color, 4);
+	if (threadBatch != NULL)
+	{
+		BatchVertex *vertex = ThreadBatchReserve(threadBatch, count);
+		if (vertex == NULL) return;
+		for (int j = 0; j < count; j++, vertex++)
+		{
+			vertex->position[0] = positions[3*j];
+			vertex->position[1] = positions[3*j + 1];
+			vertex->position[2] = positions[3*j + 2];
+			vertex->texcoord[0] = (texcoords != NULL)? texcoords[2*j] : 0.0f;
+			vertex->texcoord[1] = (texcoords != NULL)? texcoords[2*j + 1] : 0.0f;
+			memcpy(vertex->color, (colors != NULL)? &colors[4*j] : color, 4);
+		}
+		ThreadBatchCommit(threadBatch, count);
+		return;
+	}
+	int i = 0;
+	while (i < count)
+	{
+		int chunk = rlReserveVertex(count - i);
+		buffer = &RLGL.State.vertexData[RLGL.State.currentBuffer];
+		BatchVertex *vertex = &buffer->vertices[buffer->vCounter];
+		for (int j = i; j < i + chunk; j++, vertex++)
+		{
+			vertex->position[0] = positions[3*j];
+			vertex->position[1] = positions[3*j + 1];
+			vertex->position[2] = positions[3*j + 2];
+			vertex->texcoord[0] = (texcoords != NULL)? texcoords[2*j] : 0.0f;
+			vertex->texcoord[1] = (texcoords != NULL)? texcoords[2*j + 1] : 0.0f;
+			memcpy(vertex->color, (colors != NULL)? &colors[4*j] : color, 4);
+		}
+		rlCommitVertex(chunk);
+		i += chunk;
+	}
+}
+
+// Push packed quads (position, texcoord, color) using current texture
+// NOTE: Vertex are copied straight into the batch, current transform is applied at flush
+void rlPushQuads(const BatchVertex *vertices, int quadCount)
+{
+	rlBegin(RL_QUADS);
+	if (threadBatch != NULL)
+	{
+		BatchVertex *vertex = ThreadBatchReserve(threadBatch, quadCount*4);
+		if (vertex == NULL) return;
+		memcpy(vertex, vertices, sizeof(BatchVertex)*quadCount*4);
+		ThreadBatchCommit(threadBatch, quadCount*4);
+		ThreadBatchEnd(threadBatch);
+		return;
+	}
+	int i = 0;
+	while (i < quadCount*4)
+	{
+		int chunk = rlReserveVertex(quadCount*4 - i);
+		memcpy(&RLGL.State.vertexData[RLGL.State.currentBuffer].vertices[RLGL.State.vertexData[RLGL.State.currentBuffer].vCounter], &vertices[i], sizeof(BatchVertex)*chunk);
+		rlCommitVertex(chunk);
+		i += chunk;
+	}
+	rlEnd();
+}
+
 
 
 //----------------------------------------------------------------------------------
@@ -350,28 +888,18 @@ void rlColor3f(float x, float y, float z)
 // Enable texture usage
 void rlEnableTexture(unsigned int id)
 {
-	if (RLGL.State.draws[RLGL.State.drawsCounter - 1].textureId != id)
+	if (threadBatch != NULL)
 	{
-		if (RLGL.State.draws[RLGL.State.drawsCounter - 1].vertexCount > 0)
-		{
-			// Make sure current RLGL.State.draws[i].vertexCount is aligned a multiple of 4,
-			// that way, following QUADS drawing will keep aligned with index processing
-			// It implies adding some extra alignment vertex at the end of the draw,
-			// those vertex are not processed but they are considered as an additional offset
-			// for the next set of vertex to be drawn
-			if (RLGL.State.draws[RLGL.State.drawsCounter - 1].mode == RL_LINES) RLGL.State.draws[RLGL.State.drawsCounter - 1].vertexAlignment = ((RLGL.State.draws[RLGL.State.drawsCounter - 1].vertexCount < 4)? RLGL.State.draws[RLGL.State.drawsCounter - 1].vertexCount : RLGL.State.draws[RLGL.State.drawsCounter - 1].vertexCount%4);
-			else if (RLGL.State.draws[RLGL.State.drawsCounter - 1].mode == RL_TRIANGLES) RLGL.State.draws[RLGL.State.drawsCounter - 1].vertexAlignment = ((RLGL.State.draws[RLGL.State.drawsCounter - 1].vertexCount < 4)? 1 : (4 - (RLGL.State.draws[RLGL.State.drawsCounter - 1].vertexCount%4)));
-			else RLGL.State.draws[RLGL.State.drawsCounter - 1].vertexAlignment = 0;
-			if (rlCheckBufferLimit(RLGL.State.draws[RLGL.State.drawsCounter - 1].vertexAlignment)) rlglDraw();
-			else
-			{
-				RLGL.State.vertexData[RLGL.State.currentBuffer].vCounter += RLGL.State.draws[RLGL.State.drawsCounter - 1].vertexAlignment;
-				RLGL.State.vertexData[RLGL.State.currentBuffer].cCounter += RLGL.State.draws[RLGL.State.drawsCounter - 1].vertexAlignment;
-				RLGL.State.vertexData[RLGL.State.currentBuffer].tcCounter += RLGL.State.draws[RLGL.State.drawsCounter - 1].vertexAlignment;
-				RLGL.State.drawsCounter++;
-			}
+		if (threadBatch->draws[threadBatch->drawsCounter - 1].textureId != id)
+		{
+			ThreadBatchNextDraw(threadBatch);
+			threadBatch->draws[threadBatch->drawsCounter - 1].textureId = id;
 		}
-		if (RLGL.State.drawsCounter >= MAX_DRAWCALL_REGISTERED) rlglDraw();
+		return;
+	}
+	if (RLGL.State.draws[RLGL.State.drawsCounter - 1].textureId != id)
+	{
+		rlNextDrawCall();
 		RLGL.State.draws[RLGL.State.drawsCounter - 1].textureId = id;
 		RLGL.State.draws[RLGL.State.drawsCounter - 1].vertexCount = 0;
 	}
@@ -380,15 +908,22 @@ void rlEnableTexture(unsigned int id)
 // Disable texture usage
 void rlDisableTexture(void)
 {
+	if (threadBatch != NULL) return;    // Thread batches grow, no flush required
 	// NOTE: If quads batch limit is reached,
 	// we force a draw call and next batch starts
-	if (RLGL.State.vertexData[RLGL.State.currentBuffer].vCounter >= (MAX_BATCH_ELEMENTS*4)) rlglDraw();
+	if (RLGL.State.vertexData[RLGL.State.currentBuffer].vCounter >= (RLGL.State.batchElements*4))
+	{
+		RLGL.State.batchLimitFlushes++;
+		RLGL.State.flushCause = FLUSH_BUFFER_FULL;
+		rlglDraw();
+	}
 }
 
 // Set texture parameters (wrap mode/filter mode)
 void rlTextureParameters(unsigned int id, int param, int value)
 {
-	glBindTexture(GL_TEXTURE_2D, id);
+	RenderThreadAcquireContext();
+	BindTextureCached(GL_TEXTURE_2D, id);
 	switch (param)
 	{
 		case RL_TEXTURE_WRAP_S:
@@ -408,20 +943,21 @@ void rlTextureParameters(unsigned int id, int param, int value)
 			if (value <= RLGL.ExtSupported.maxAnisotropicLevel) glTexParameterf(GL_TEXTURE_2D, GL_TEXTURE_MAX_ANISOTROPY_EXT, (float)value);
 			else if (RLGL.ExtSupported.maxAnisotropicLevel > 0.0f)
 			{
-				debugNetPrintf(ERROR, "[ORBISGL] %s [TEX ID %i] Maximum anisotropic filter level supported is %iX\n",__FUNCTION__,id, RLGL.ExtSupported.maxAnisotropicLevel);
+				debugNetPrintf(ERROR, "[ORBISGL] %s [TEX ID %i] Maximum anisotropic filter level supported is %iX\n",__FUNCTION__,id, (int)RLGL.ExtSupported.maxAnisotropicLevel);
 				glTexParameterf(GL_TEXTURE_2D, GL_TEXTURE_MAX_ANISOTROPY_EXT, (float)value);
 			}
 			else debugNetPrintf(ERROR, "[ORBISGL] %s Anisotropic filtering not supported\n",__FUNCTION__);
 		} break;
 		default: break;
 	}
-	glBindTexture(GL_TEXTURE_2D, 0);
+	// NOTE: Texture is kept bound, state cache skips rebinding it on following draws
 }
 
 // Enable rendering to texture (fbo)
 void rlEnableRenderTexture(unsigned int id)
 {
-	glBindFramebuffer(GL_FRAMEBUFFER, id);
+	if (RenderThreadRecording()) RenderThreadPushParams(RC_FRAMEBUFFER, id, 0, 0, 0);
+	else glBindFramebuffer(GL_FRAMEBUFFER, id);
 	//glDisable(GL_CULL_FACE);    // Allow double side drawing for texture flipping
 	//glCullFace(GL_FRONT);
 }
@@ -429,31 +965,36 @@ void rlEnableRenderTexture(unsigned int id)
 // Disable rendering to texture
 void rlDisableRenderTexture(void)
 {
-	glBindFramebuffer(GL_FRAMEBUFFER, 0);
+	if (RenderThreadRecording()) RenderThreadPushParams(RC_FRAMEBUFFER, 0, 0, 0, 0);
+	else glBindFramebuffer(GL_FRAMEBUFFER, 0);
 	//glEnable(GL_CULL_FACE);
 	//glCullFace(GL_BACK);
 }
 
 // Enable depth test
-void rlEnableDepthTest(void) { glEnable(GL_DEPTH_TEST); }
+void rlEnableDepthTest(void) { SetCapabilityCached(GL_DEPTH_TEST, true); }
 
 // Disable depth test
-void rlDisableDepthTest(void) { glDisable(GL_DEPTH_TEST); }
+void rlDisableDepthTest(void) { SetCapabilityCached(GL_DEPTH_TEST, false); }
 
 // Enable backface culling
-void rlEnableBackfaceCulling(void) { glEnable(GL_CULL_FACE); }
+void rlEnableBackfaceCulling(void) { SetCapabilityCached(GL_CULL_FACE, true); }
 
 // Disable backface culling
-void rlDisableBackfaceCulling(void) { glDisable(GL_CULL_FACE); }
+void rlDisableBackfaceCulling(void) { SetCapabilityCached(GL_CULL_FACE, false); }
 
 // Enable scissor test
-void rlEnableScissorTest(void) { glEnable(GL_SCISSOR_TEST); }
+void rlEnableScissorTest(void) { SetCapabilityCached(GL_SCISSOR_TEST, true); }
 
 // Disable scissor test
-void rlDisableScissorTest(void) { glDisable(GL_SCISSOR_TEST); }
+void rlDisableScissorTest(void) { SetCapabilityCached(GL_SCISSOR_TEST, false); }
 
 // Scissor test
-void rlScissor(int x, int y, int width, int height) { glScissor(x, y, width, height); }
+void rlScissor(int x, int y, int width, int height)
+{
+	if (RenderThreadRecording()) RenderThreadPushParams(RC_SCISSOR, x, y, width, height);
+	else glScissor(x, y, width, height);
+}
 
 // Enable wire mode
 void rlEnableWireMode(void)
@@ -472,16 +1013,24 @@ void rlDisableWireMode(void)
 // Unload texture from GPU memory
 void rlDeleteTextures(unsigned int id)
 {
+	RenderThreadAcquireContext();
 	if (id > 0) glDeleteTextures(1, &id);
+	ForgetObjectCached(GL_TEXTURE_2D, id);
 }
 
 // Unload render texture from GPU memory
 void rlDeleteRenderTextures(RenderTexture2D target)
 {
+	RenderThreadAcquireContext();
 	if (target.texture.id > 0) glDeleteTextures(1, &target.texture.id);
+	ForgetObjectCached(GL_TEXTURE_2D, target.texture.id);
 	if (target.depth.id > 0)
 	{
-		if (target.depthTexture) glDeleteTextures(1, &target.depth.id);
+		if (target.depthTexture)
+		{
+			glDeleteTextures(1, &target.depth.id);
+			ForgetObjectCached(GL_TEXTURE_2D, target.depth.id);
+		}
 		else glDeleteRenderbuffers(1, &target.depth.id);
 	}
 	if (target.id > 0) glDeleteFramebuffers(1, &target.id);
@@ -491,15 +1040,19 @@ void rlDeleteRenderTextures(RenderTexture2D target)
 // Unload shader from GPU memory
 void rlDeleteShader(unsigned int id)
 {
+	RenderThreadAcquireContext();
 	if (id != 0) glDeleteProgram(id);
+	ForgetObjectCached(GL_CURRENT_PROGRAM, id);
 }
 
 // Unload vertex data (VAO) from GPU memory
 void rlDeleteVertexArrays(unsigned int id)
 {
+	RenderThreadAcquireContext();
 	if (RLGL.ExtSupported.vao)
 	{
 		if (id != 0) glDeleteVertexArrays(1, &id);
+		ForgetObjectCached(GL_VERTEX_ARRAY_BINDING_OES, id);
 		debugNetPrintf(INFO, "[ORBISG] %s [VAO ID %i] Unloaded model data from VRAM (GPU)\n",__FUNCTION__, id);
 	}
 }
@@ -507,9 +1060,11 @@ void rlDeleteVertexArrays(unsigned int id)
 // Unload vertex data (VBO) from GPU memory
 void rlDeleteBuffers(unsigned int id)
 {
+	RenderThreadAcquireContext();
 	if (id != 0)
 	{
 		glDeleteBuffers(1, &id);
+		ForgetObjectCached(GL_ARRAY_BUFFER, id);
 		if (!RLGL.ExtSupported.vao) debugNetPrintf(INFO, "[ORBISGL] %s [VBO ID %i] Unloaded model vertex data from VRAM (GPU)\n",__FUNCTION__,id);
 	}
 }
@@ -522,12 +1077,18 @@ void rlClearColor(byte r, byte g, byte b, byte a)
 	float cg = (float)g/255;
 	float cb = (float)b/255;
 	float ca = (float)a/255;
-	glClearColor(cr, cg, cb, ca);
+	if (RenderThreadRecording()) RenderThreadPushParams(RC_CLEAR_COLOR, r, g, b, a);
+	else glClearColor(cr, cg, cb, ca);
 }
 
 // Clear used screen buffers (color and depth)
 void rlClearScreenBuffers(void)
 {
+	if (RenderThreadRecording())
+	{
+		RenderThreadPushParams(RC_CLEAR, 0, 0, 0, 0);
+		return;
+	}
 	glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);     // Clear used buffers: Color and Depth (Depth is used for 3D)
 	//glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT | GL_STENCIL_BUFFER_BIT);     // Stencil buffer not used...
 }
@@ -535,7 +1096,18 @@ void rlClearScreenBuffers(void)
 // Update GPU buffer with new data
 void rlUpdateBuffer(int bufferId, void *data, int dataSize)
 {
-	glBindBuffer(GL_ARRAY_BUFFER, bufferId);
+	RLGL.State.frameStats.bytesUploaded += dataSize;
+	if (RenderThreadRecording())
+	{
+		RenderCommand *command = RenderThreadPush(RC_BUFFER_UPDATE, data, dataSize);
+		if (command != NULL)
+		{
+			command->params[0] = bufferId;
+			return;
+		}
+		RenderThreadAcquireContext();   // Command could not be recorded, recorded work is executed and buffer updated synchronously
+	}
+	BindBufferCached(GL_ARRAY_BUFFER, bufferId);
 	glBufferSubData(GL_ARRAY_BUFFER, 0, dataSize, data);
 }
 
@@ -547,6 +1119,13 @@ void rlUpdateBuffer(int bufferId, void *data, int dataSize)
 // Initialize rlgl: OpenGL extensions, default buffers/shaders/textures, OpenGL states
 void rlglInit(int width, int height)
 {
+	rlglInitEx(width, height, MAX_BATCH_ELEMENTS, MAX_DRAWCALL_REGISTERED);
+}
+
+// Initialize rlgl with custom batch capacity (quads) and draw calls registry size
+void rlglInitEx(int width, int height, int batchElements, int maxDrawCalls)
+{
+	rlResetStateCache();
 	// Check OpenGL information and capabilities
 	//------------------------------------------------------------------------------
 	// Print current OpenGL and GLSL version
@@ -643,6 +1222,17 @@ void rlglInit(int width, int height)
 		if (strcmp(extList[i], (const char *)"GL_EXT_texture_mirror_clamp") == 0) RLGL.ExtSupported.texMirrorClamp = true;
 		// Debug marker support
 		if (strcmp(extList[i], (const char *)"GL_EXT_debug_marker") == 0) RLGL.ExtSupported.debugMarker = true;
+		// 32 bit element indices support
+		if (strcmp(extList[i], (const char *)"GL_OES_element_index_uint") == 0) RLGL.ExtSupported.elementIndexUint = true;
+		// Program binary support, NOTE: Driver could expose no binary format at all
+		if (strcmp(extList[i], (const char *)"GL_OES_get_program_binary") == 0)
+		{
+			GLint formatsCount = 0;
+			glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS_OES, &formatsCount);
+			glGetProgramBinary = (PFNGLGETPROGRAMBINARYOESPROC)eglGetProcAddress("glGetProgramBinaryOES");
+			glProgramBinary = (PFNGLPROGRAMBINARYOESPROC)eglGetProcAddress("glProgramBinaryOES");
+			if ((formatsCount > 0) && (glGetProgramBinary != NULL) && (glProgramBinary != NULL)) RLGL.ExtSupported.programBinary = true;
+		}
 	}
 
 	// Free extensions pointers
@@ -660,6 +1250,8 @@ void rlglInit(int width, int height)
 	if (RLGL.ExtSupported.texAnisoFilter) debugNetPrintf(INFO, "[EXTENSION] Anisotropic textures filtering supported (max: %.0fX)", RLGL.ExtSupported.maxAnisotropicLevel);
 	if (RLGL.ExtSupported.texMirrorClamp) debugNetPrintf(INFO, "[EXTENSION] Mirror clamp wrap texture mode supported");
 	if (RLGL.ExtSupported.debugMarker) debugNetPrintf(INFO, "[EXTENSION] Debug Marker supported");
+	if (RLGL.ExtSupported.elementIndexUint) debugNetPrintf(INFO, "[EXTENSION] 32 bit element indices supported");
+	if (RLGL.ExtSupported.programBinary) debugNetPrintf(INFO, "[EXTENSION] Program binaries supported, shader cache available");
 	// Initialize buffers, default shaders and default textures
 	//----------------------------------------------------------
 	// Init default white texture
@@ -670,43 +1262,32 @@ void rlglInit(int width, int height)
 	// Init default Shader (customized for GL 3.3 and ES2)
 	RLGL.State.defaultShader = LoadShaderDefault();
 	RLGL.State.currentShader = RLGL.State.defaultShader;
-	// Init default vertex arrays buffers
-	LoadBuffersDefault();
+	// Init default vertex arrays buffers and draw calls tracking system
+	rlSetBatchCapacity(batchElements, maxDrawCalls);
 	// Init transformations matrix accumulator
 	RLGL.State.transform = MatrixIdentity();
-	// Init draw calls tracking system
-	RLGL.State.draws = (DrawCall *)malloc(sizeof(DrawCall)*MAX_DRAWCALL_REGISTERED);
-	for (int i = 0; i < MAX_DRAWCALL_REGISTERED; i++)
-	{
-		RLGL.State.draws[i].mode = RL_QUADS;
-		RLGL.State.draws[i].vertexCount = 0;
-		RLGL.State.draws[i].vertexAlignment = 0;
-		//RLGL.State.draws[i].vaoId = 0;
-		//RLGL.State.draws[i].shaderId = 0;
-		RLGL.State.draws[i].textureId = RLGL.State.defaultTextureId;
-		//RLGL.State.draws[i].RLGL.State.projection = MatrixIdentity();
-		//RLGL.State.draws[i].RLGL.State.modelview = MatrixIdentity();
-	}
-	RLGL.State.drawsCounter = 1;
 	// Init RLGL.State.stack matrices (emulating OpenGL 1.1)
 	for (int i = 0; i < MAX_MATRIX_STACK_SIZE; i++) RLGL.State.stack[i] = MatrixIdentity();
 	// Init RLGL.State.projection and RLGL.State.modelview matrices
 	RLGL.State.projection = MatrixIdentity();
 	RLGL.State.modelview = MatrixIdentity();
 	RLGL.State.currentMatrix = &RLGL.State.modelview;
+	RLGL.State.viewProjectionDirty = true;
+	RLGL.State.meshViewProjectionDirty = true;
+	memset(RLGL.State.flushColor, 255, 4);      // White until a buffer full flush carries a color
 	// Initialize OpenGL default states
 	//----------------------------------------------------------
 	// Init state: Depth test
 	glDepthFunc(GL_LEQUAL);                                 // Type of depth testing to apply
-	glDisable(GL_DEPTH_TEST);                               // Disable depth testing for 2D (only used for 3D)
+	SetCapabilityCached(GL_DEPTH_TEST, false);              // Disable depth testing for 2D (only used for 3D)
 	// Init state: Blending mode
-	glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);      // Color blending function (how colors are mixed)
+	BlendFuncCached(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);  // Color blending function (how colors are mixed)
 	glEnable(GL_BLEND);                                     // Enable color blending (required to work with transparencies)
 	// Init state: Culling
 	// NOTE: All shapes/models triangles are drawn CCW
 	glCullFace(GL_BACK);                                    // Cull the back face (default)
 	glFrontFace(GL_CCW);                                    // Front face are defined counter clockwise (default)
-	glEnable(GL_CULL_FACE);                                 // Enable backface culling
+	SetCapabilityCached(GL_CULL_FACE, true);                // Enable backface culling
 
 	// Init state: Color/Depth buffers clear
 	glClearColor(0.0f, 0.0f, 0.0f, 1.0f);                   // Set clear color (black)
@@ -724,22 +1305,118 @@ void rlglInit(int width, int height)
 // Vertex Buffer Object deinitialization (memory free)
 void rlglClose(void)
 {
+	rlDisableRenderThread();            // Render thread stopped, EGL context back to this thread
+	UnloadThreadBatches();
+	UnloadUniformsCached();
+	UnloadShaderVariants(defaultVariants);
+	defaultVariants = (ShaderVariants){ 0 };
 	UnloadShaderDefault();              // Unload default shader
 	UnloadBuffersDefault();             // Unload default buffers
 	glDeleteTextures(1, &RLGL.State.defaultTextureId); // Unload default texture
+	ForgetObjectCached(GL_TEXTURE_2D, RLGL.State.defaultTextureId);
 	debugNetPrintf(INFO, "[ORBISGL] [TEX ID %i] Unloaded texture data (base white texture) from VRAM\n", RLGL.State.defaultTextureId);
-	free(RLGL.State.draws);
+}
+
+// End current run of batch flushes, keeping frame peak
+static void EndBatchRun(void)
+{
+	if (RLGL.State.runVertexCount > RLGL.State.peakVertexCount) RLGL.State.peakVertexCount = RLGL.State.runVertexCount;
+	if (RLGL.State.runDrawCount > RLGL.State.peakDrawCount) RLGL.State.peakDrawCount = RLGL.State.runDrawCount;
+	RLGL.State.runVertexCount = 0;
+	RLGL.State.runDrawCount = 0;
 }
 
 // Update and draw internal buffers
 void rlglDraw(void)
 {
+	if (threadBatch != NULL) return;    // Thread batches are only drawn by rendering thread, once merged
+	BeginProfileScope("rlglDraw");
+	int cause = RLGL.State.flushCause;
+	RLGL.State.flushCause = FLUSH_EXPLICIT;
 	// Only process data if we have data to process
 	if (RLGL.State.vertexData[RLGL.State.currentBuffer].vCounter > 0)
 	{
-		UpdateBuffersDefault();
-		DrawBuffersDefault();       // NOTE: Stereo rendering is checked inside
+		if (!RLGL.State.listRecording)
+		{
+			RLGL.State.runVertexCount += RLGL.State.vertexData[RLGL.State.currentBuffer].vCounter;
+			RLGL.State.runDrawCount += RLGL.State.drawsCounter;
+			RLGL.State.frameStats.vertexCount += RLGL.State.vertexData[RLGL.State.currentBuffer].vCounter;
+			RLGL.State.frameStats.flushes++;
+			RLGL.State.frameStats.flushesByCause[cause]++;
+		}
+		if (RLGL.State.unorderedRegion) SortBuffersDefault();
+		TransformBuffersDefault();
+		if (RLGL.State.listRecording) RecordBuffersDefault();   // Display list captures vertex data instead
+		else if (RenderThreadRecording()) RenderThreadRecordBatch();    // Render thread uploads and draws it
+		else
+		{
+			UpdateBuffersDefault();
+			DrawBuffersDefault();       // NOTE: Stereo rendering is checked inside
+		}
+		// Unordered region continues on the next batch
+		RLGL.State.unorderedFirstDraw = 0;
+	}
+	// Flushes caused by batch capacity split what a bigger batch would flush at once, runs of them are sized together
+	if (!RLGL.State.listRecording && (cause != FLUSH_BUFFER_FULL) && (cause != FLUSH_BUFFER_LIMIT) && (cause != FLUSH_DRAW_LIMIT)) EndBatchRun();
+	EndProfileScope();
+}
+
+// Retire batch buffers once the frame has been swapped
+// NOTE: Buffers drawn again before this call are counted as ring wraps in flight
+void rlglEndFrame(void)
+{
+	for (int i = 0; i < MAX_BATCH_BUFFERING; i++) RLGL.State.vertexData[i].inFlight = false;
+	if (renderThread.enabled)
+	{
+		// State cache is owned by render thread, its counters lag one frame behind
+		RLGL.State.frameStats.stateCallsElided = renderThread.lastCacheStats.stateCallsElided;
+		RLGL.State.frameStats.textureBinds = renderThread.lastCacheStats.textureBinds;
+		RLGL.State.frameStats.uniformUploadsSkipped = renderThread.lastCacheStats.uniformUploadsSkipped;
 	}
+	else
+	{
+		EndFrameCached();
+		GetFrameStatsCached(&RLGL.State.frameStats);
+	}
+	RLGL.State.lastFrameStats = RLGL.State.frameStats;
+	// Grow batch if last frame was split by capacity, so its largest flush fits in a single buffer
+	// NOTE: Growth stops at MAX_BATCH_ELEMENTS_GROWTH quads and MAX_DRAWCALL_GROWTH draws, larger capacities are only set by rlSetBatchCapacity()
+	EndBatchRun();
+	if (RLGL.State.batchGrowth && ((RLGL.State.batchLimitFlushes > 0) || (RLGL.State.drawLimitFlushes > 0)))
+	{
+		int batchElements = RLGL.State.batchElements;
+		int maxDrawCalls = RLGL.State.maxDrawCalls;
+		if (RLGL.State.batchLimitFlushes > 0)
+		{
+			while ((batchElements*4 < RLGL.State.peakVertexCount) && (batchElements < MAX_BATCH_ELEMENTS_GROWTH))
+			{
+				batchElements *= 2;
+				if (batchElements > MAX_BATCH_ELEMENTS_GROWTH) batchElements = MAX_BATCH_ELEMENTS_GROWTH;
+			}
+		}
+		if (RLGL.State.drawLimitFlushes > 0)
+		{
+			while ((maxDrawCalls < RLGL.State.peakDrawCount) && (maxDrawCalls < MAX_DRAWCALL_GROWTH))
+			{
+				maxDrawCalls *= 2;
+				if (maxDrawCalls > MAX_DRAWCALL_GROWTH) maxDrawCalls = MAX_DRAWCALL_GROWTH;
+			}
+		}
+		if ((batchElements != RLGL.State.batchElements) || (maxDrawCalls != RLGL.State.maxDrawCalls)) rlSetBatchCapacity(batchElements, maxDrawCalls);
+	}
+	// Reset per frame counters for next frame
+	memset(&RLGL.State.frameStats, 0, sizeof(FrameStats));
+	RLGL.State.flushCause = FLUSH_EXPLICIT;
+	RLGL.State.peakVertexCount = 0;
+	RLGL.State.peakDrawCount = 0;
+	RLGL.State.batchLimitFlushes = 0;
+	RLGL.State.drawLimitFlushes = 0;
+}
+
+// Get number of times the batch ring reused a buffer still in flight
+unsigned int rlGetBatchRingWraps(void)
+{
+	return RLGL.State.ringWrapsInFlight;
 }
 
 // Returns current OpenGL version
@@ -751,16 +1428,259 @@ int rlGetVersion(void)
 // Check internal buffer overflow for a given number of vertex
 bool rlCheckBufferLimit(int vCount)
 {
+	if (threadBatch != NULL) return false;  // Thread batches grow, callers must not flush
 	bool overflow = false;
-	if ((RLGL.State.vertexData[RLGL.State.currentBuffer].vCounter + vCount) >= (MAX_BATCH_ELEMENTS*4)) overflow = true;
+	if ((RLGL.State.vertexData[RLGL.State.currentBuffer].vCounter + vCount) >= (RLGL.State.batchElements*4)) overflow = true;
+	// NOTE: Callers flush on overflow, keep track of it for the growth policy
+	if (overflow)
+	{
+		RLGL.State.batchLimitFlushes++;
+		RLGL.State.flushCause = FLUSH_BUFFER_LIMIT;
+	}
 	return overflow;
 }
 
+// Set default batch capacity (quads) and draw calls registry size
+// NOTE: Pending batch data is flushed and buffers are reloaded, call it between frames
+void rlSetBatchCapacity(int batchElements, int maxDrawCalls)
+{
+	RenderThreadAcquireContext();
+	if (batchElements <= 0) batchElements = MAX_BATCH_ELEMENTS;
+	if (maxDrawCalls <= 0) maxDrawCalls = MAX_DRAWCALL_REGISTERED;
+	// Indices are 16 bit unless batch exceeds 65536 vertex and 32 bit indices are supported
+	unsigned int indexType = GL_UNSIGNED_SHORT;
+	if (batchElements*4 > 65536)
+	{
+		if (RLGL.ExtSupported.elementIndexUint) indexType = GL_UNSIGNED_INT;
+		else
+		{
+			debugNetPrintf(ERROR, "[ORBISGL] %s 32 bit indices not supported, batch limited to %i elements\n",__FUNCTION__, 65536/4);
+			batchElements = 65536/4;
+		}
+	}
+	if (RLGL.State.draws != NULL)
+	{
+		if ((batchElements == RLGL.State.batchElements) && (maxDrawCalls == RLGL.State.maxDrawCalls)) return;
+		rlglDraw();
+		UnloadBuffersDefault();
+	}
+	RLGL.State.batchElements = batchElements;
+	RLGL.State.maxDrawCalls = maxDrawCalls;
+	RLGL.State.indexType = indexType;
+	LoadBuffersDefault();
+}
+
+// Enable batch growth between frames from previous frame usage
+// NOTE: Sized from the largest run of flushes caused by batch capacity, not from frame totals
+void rlSetBatchGrowth(bool enabled)
+{
+	RLGL.State.batchGrowth = enabled;
+}
+
+// Begin order independent region
+// NOTE: Draws inside the region are merged by texture and mode (stable) at region end or flush,
+// only use it for content where overlapping draws order does not matter
+void rlBeginUnorderedRegion(void)
+{
+	if (RLGL.State.unorderedRegion) return;
+	rlNextDrawCall();
+	RLGL.State.unorderedFirstDraw = RLGL.State.drawsCounter - 1;
+	RLGL.State.unorderedRegion = true;
+}
+
+// End order independent region
+void rlEndUnorderedRegion(void)
+{
+	if (!RLGL.State.unorderedRegion) return;
+	SortBuffersDefault();
+	RLGL.State.unorderedRegion = false;
+}
+
+// Get draws submitted inside unordered regions and draws left after merging on last frame
+void rlGetUnorderedStats(unsigned int *drawsIn, unsigned int *drawsOut)
+{
+	if (drawsIn != NULL) *drawsIn = RLGL.State.lastFrameStats.unorderedDrawsIn;
+	if (drawsOut != NULL) *drawsOut = RLGL.State.lastFrameStats.unorderedDrawsOut;
+}
+
+// Invalidate GL state cache, following state calls are always issued
+// NOTE: Required after changing GL state directly (outside rlgl)
+void rlResetStateCache(void)
+{
+	RenderThreadAcquireContext();
+	RLGL.Cache.program = RL_STATE_UNKNOWN;
+	RLGL.Cache.activeUnit = RL_STATE_UNKNOWN;
+	for (int i = 0; i < MAX_MATERIAL_MAPS; i++)
+	{
+		RLGL.Cache.texture2D[i] = RL_STATE_UNKNOWN;
+		RLGL.Cache.textureCube[i] = RL_STATE_UNKNOWN;
+	}
+	RLGL.Cache.arrayBuffer = RL_STATE_UNKNOWN;
+	RLGL.Cache.elementBuffer = RL_STATE_UNKNOWN;
+	RLGL.Cache.vao = RL_STATE_UNKNOWN;
+	RLGL.Cache.blendSrc = RL_STATE_UNKNOWN;
+	RLGL.Cache.blendDst = RL_STATE_UNKNOWN;
+	RLGL.Cache.depthTest = -1;
+	RLGL.Cache.cullFace = -1;
+	RLGL.Cache.scissorTest = -1;
+	ResetUniformsCached();
+}
+
+// Get redundant GL state calls skipped on last frame
+int rlGetStateCallsElided(void)
+{
+	return RLGL.State.lastFrameStats.stateCallsElided;
+}
+
+// Get rendering stats of last frame
+// NOTE: Stats are collected between rlglEndFrame() calls (once per EndDrawing())
+FrameStats rlGetFrameStats(void)
+{
+	return RLGL.State.lastFrameStats;
+}
+
+// Begin recording rl* vertex submissions into a display list
+// NOTE: Vertex are captured after rlPushMatrix() transforms, current modelview is not baked
+void rlBeginList(void)
+{
+	if (RLGL.State.listRecording)
+	{
+		debugNetPrintf(ERROR, "[ORBISGL] %s Display list already being recorded\n",__FUNCTION__);
+		return;
+	}
+	rlglDraw();     // Pending vertex data does not belong to the list
+	RLGL.State.listVertexCapacity = 4*RLGL.State.batchElements;
+	RLGL.State.listVertices = (BatchVertex *)malloc(sizeof(BatchVertex)*RLGL.State.listVertexCapacity);
+	RLGL.State.listVertexCount = 0;
+	RLGL.State.listDrawsCapacity = 16;
+	RLGL.State.listDraws = (DrawCall *)malloc(sizeof(DrawCall)*RLGL.State.listDrawsCapacity);
+	RLGL.State.listDrawsCount = 0;
+	RLGL.State.listRecording = true;
+}
+
+// End recording and upload display list vertex data to a static GPU buffer
+DisplayList rlEndList(void)
+{
+	RenderThreadAcquireContext();
+	DisplayList list = { 0 };
+	if (!RLGL.State.listRecording)
+	{
+		debugNetPrintf(ERROR, "[ORBISGL] %s No display list being recorded\n",__FUNCTION__);
+		return list;
+	}
+	rlglDraw();     // Record remaining vertex data
+	RLGL.State.listRecording = false;
+	if (RLGL.State.listVertexCount > 0)
+	{
+		if (RLGL.ExtSupported.vao)
+		{
+			glGenVertexArrays(1, &list.vaoId);
+			BindVertexArrayCached(list.vaoId);
+		}
+		glGenBuffers(1, &list.vboId);
+		BindBufferCached(GL_ARRAY_BUFFER, list.vboId);
+		glBufferData(GL_ARRAY_BUFFER, sizeof(BatchVertex)*RLGL.State.listVertexCount, RLGL.State.listVertices, GL_STATIC_DRAW);
+		SetBufferAttribsDefault();
+		if (RLGL.ExtSupported.vao) BindVertexArrayCached(0);
+		list.vertexCount = RLGL.State.listVertexCount;
+		list.drawsCount = RLGL.State.listDrawsCount;
+		list.draws = RLGL.State.listDraws;     // Draws ownership moves to the list
+		// Shader locations are copied, shaders could be unloaded before the list (locs freed)
+		list.locs = (int *)malloc(sizeof(int)*MAX_SHADER_LOCATIONS*list.drawsCount);
+		for (int i = 0, copied = 0; i < list.drawsCount; i++)
+		{
+			int j = 0;
+			while ((j < i) && (list.draws[j].shader.id != list.draws[i].shader.id)) j++;
+			if (j < i) list.draws[i].shader.locs = list.draws[j].shader.locs;
+			else if ((list.locs != NULL) && (list.draws[i].shader.locs != NULL))
+			{
+				memcpy(&list.locs[copied*MAX_SHADER_LOCATIONS], list.draws[i].shader.locs, sizeof(int)*MAX_SHADER_LOCATIONS);
+				list.draws[i].shader.locs = &list.locs[(copied++)*MAX_SHADER_LOCATIONS];
+			}
+			else list.draws[i].shader = RLGL.State.defaultShader;    // No copy available, drawn with default shader
+		}
+		debugNetPrintf(INFO, "[ORBISGL] %s [VBO ID %i] Display list uploaded (%i vertex, %i draws)\n",__FUNCTION__, list.vboId, list.vertexCount, list.drawsCount);
+	}
+	else free(RLGL.State.listDraws);
+	// Vertex data already on GPU, no CPU copy is kept
+	free(RLGL.State.listVertices);
+	RLGL.State.listVertices = NULL;
+	RLGL.State.listDraws = NULL;
+	RLGL.State.listVertexCount = 0;
+	RLGL.State.listDrawsCount = 0;
+	return list;
+}
+
+// Draw display list with an additional transform
+// NOTE: Pending batch is drawn first to keep drawing order, list vertex data is not re-submitted
+void rlDrawList(DisplayList list, Matrix transform)
+{
+	if (list.vboId == 0) return;
+	RLGL.State.flushCause = FLUSH_STATE_CHANGE;
+	rlglDraw();
+	Matrix matMVP = MatrixMultiply(transform, GetMeshViewProjection());
+	if (RenderThreadRecording()) RenderThreadRecordList(list, matMVP);
+	else DrawListDefault(list.vaoId, list.vboId, list.draws, list.drawsCount, matMVP, RLGL.State.currentBlendMode);
+	RLGL.State.frameStats.drawCalls += list.drawsCount;
+}
+
+// Draw display list draws with MVP provided, returns number of GL draw calls
+// NOTE: Used by rlDrawList() and by render thread
+int DrawListDefault(unsigned int vaoId, unsigned int vboId, const DrawCall *draws, int drawsCount, Matrix matMVP, int currentBlendMode)
+{
+	unsigned int shaderId = 0;
+	int blendMode = currentBlendMode;
+	int vertexOffset = 0;
+	float16 mvp = MatrixToFloatV(matMVP);
+	float colDiffuse[4] = { 1.0f, 1.0f, 1.0f, 1.0f };
+	int mapDiffuse = 0;
+	if (RLGL.ExtSupported.vao) BindVertexArrayCached(vaoId);
+	else
+	{
+		BindBufferCached(GL_ARRAY_BUFFER, vboId);
+		SetBufferAttribsDefault();
+	}
+	ActiveTextureCached(0);
+	for (int i = 0; i < drawsCount; i++)
+	{
+		if (draws[i].shader.id != shaderId)
+		{
+			shaderId = draws[i].shader.id;
+			UseProgramCached(shaderId);
+			SetUniformCached(shaderId, draws[i].shader.locs[LOC_MATRIX_MVP], UNIFORM_MATRIX, mvp.v, 1);
+			SetUniformCached(shaderId, draws[i].shader.locs[LOC_COLOR_DIFFUSE], UNIFORM_VEC4, colDiffuse, 1);
+			SetUniformCached(shaderId, draws[i].shader.locs[LOC_MAP_DIFFUSE], UNIFORM_INT, &mapDiffuse, 1);
+		}
+		if (draws[i].blendMode != blendMode)
+		{
+			blendMode = draws[i].blendMode;
+			SetBlendModeDefault(blendMode);
+		}
+		BindTextureCached(GL_TEXTURE_2D, draws[i].textureId);
+		glDrawArrays(draws[i].mode, vertexOffset, draws[i].vertexCount);
+		vertexOffset += draws[i].vertexCount;
+	}
+	if (blendMode != currentBlendMode) SetBlendModeDefault(currentBlendMode);
+	if (RLGL.ExtSupported.vao) BindVertexArrayCached(0);
+	return drawsCount;
+}
+
+// Unload display list from GPU and CPU
+void rlUnloadList(DisplayList list)
+{
+	RenderThreadAcquireContext();
+	rlDeleteBuffers(list.vboId);
+	rlDeleteVertexArrays(list.vaoId);
+	free(list.draws);
+	free(list.locs);
+}
+
 // Set debug marker
+// NOTE: Marker is added to the profiler trace (see ExportProfileTrace()), text is not copied
 void rlSetDebugMarker(const char *text)
 {
 	//if(RLGL.ExtSupported.debugMarker) glInsertEventMarkerEXT(0, text);
-
+	AddProfileMarker(text);
 }
 
 // Load OpenGL extensions
@@ -791,7 +1711,8 @@ Vector3 rlUnproject(Vector3 source, Matrix proj, Matrix view)
 // Convert image data to OpenGL texture (returns OpenGL valid Id)
 unsigned int rlLoadTexture(void *data, int width, int height, int format, int mipmapCount)
 {
-	glBindTexture(GL_TEXTURE_2D, 0);    // Free any old binding
+	RenderThreadAcquireContext();
+	BindTextureCached(GL_TEXTURE_2D, 0);    // Free any old binding
 	unsigned int id = 0;
 	
 	if ((!RLGL.ExtSupported.texCompDXT) && ((format == COMPRESSED_DXT1_RGB) || (format == COMPRESSED_DXT1_RGBA) ||
@@ -823,11 +1744,11 @@ unsigned int rlLoadTexture(void *data, int width, int height, int format, int mi
 	glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
 	glGenTextures(1, &id);              // Generate texture id
 	//glActiveTexture(GL_TEXTURE0);     // If not defined, using GL_TEXTURE0 by default (shader texture)
-	glBindTexture(GL_TEXTURE_2D, id);
+	BindTextureCached(GL_TEXTURE_2D, id);
 	int mipWidth = width;
 	int mipHeight = height;
 	int mipOffset = 0;          // Mipmap data offset
-	debugNetPrintf(DEBUG,"[ORBISGL] %s Load texture from data memory address: 0x%x\n",__FUNCTION__,data);
+	debugNetPrintf(DEBUG,"[ORBISGL] %s Load texture from data memory address: %p\n",__FUNCTION__,data);
 	// Load the different mipmap levels
 	for (int i = 0; i < mipmapCount; i++)
 	{
@@ -867,7 +1788,7 @@ unsigned int rlLoadTexture(void *data, int width, int height, int format, int mi
 	// At this point we have the texture loaded in GPU and texture parameters configured
 	// NOTE: If mipmaps were not in data, they are not generated automatically
 	// Unbind current texture
-	glBindTexture(GL_TEXTURE_2D, 0);
+	BindTextureCached(GL_TEXTURE_2D, 0);
 	if (id > 0) debugNetPrintf(INFO, "[ORBISGL] %s [TEX ID %i] Texture created successfully (%ix%i - %i mipmaps)\n",__FUNCTION__,id, width, height, mipmapCount);
 	else debugNetPrintf(ERROR, "[ORBISGL] %s Texture could not be created\n",__FUNCTION__);
 	return id;
@@ -877,6 +1798,7 @@ unsigned int rlLoadTexture(void *data, int width, int height, int format, int mi
 // WARNING: OpenGL ES 2.0 requires GL_OES_depth_texture/WEBGL_depth_texture extensions
 unsigned int rlLoadTextureDepth(int width, int height, int bits, bool useRenderBuffer)
 {
+	RenderThreadAcquireContext();
 	unsigned int id = 0;
 	unsigned int glInternalFormat = GL_DEPTH_COMPONENT16;
 	if ((bits != 16) && (bits != 24) && (bits != 32)) bits = 16;
@@ -891,13 +1813,13 @@ unsigned int rlLoadTextureDepth(int width, int height, int bits, bool useRenderB
 	if (!useRenderBuffer && RLGL.ExtSupported.texDepth)
 	{
 		glGenTextures(1, &id);
-		glBindTexture(GL_TEXTURE_2D, id);
+		BindTextureCached(GL_TEXTURE_2D, id);
 		glTexImage2D(GL_TEXTURE_2D, 0, glInternalFormat, width, height, 0, GL_DEPTH_COMPONENT, GL_UNSIGNED_INT, NULL);
 		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
 		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
 		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
 		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
-		glBindTexture(GL_TEXTURE_2D, 0);
+		BindTextureCached(GL_TEXTURE_2D, 0);
 	}
 	else
 	{
@@ -916,10 +1838,11 @@ unsigned int rlLoadTextureDepth(int width, int height, int bits, bool useRenderB
 // expected the following convention: +X, -X, +Y, -Y, +Z, -Z
 unsigned int rlLoadTextureCubemap(void *data, int size, int format)
 {
+	RenderThreadAcquireContext();
 	unsigned int cubemapId = 0;
 	unsigned int dataSize = GetPixelDataSize(size, size, format);
 	glGenTextures(1, &cubemapId);
-	glBindTexture(GL_TEXTURE_CUBE_MAP, cubemapId);
+	BindTextureCached(GL_TEXTURE_CUBE_MAP, cubemapId);
 	unsigned int glInternalFormat, glFormat, glType;
 	rlGetGlTextureFormats(format, &glInternalFormat, &glFormat, &glType);
 	if (glInternalFormat != -1)
@@ -936,7 +1859,7 @@ unsigned int rlLoadTextureCubemap(void *data, int size, int format)
 	glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
 	glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
 	glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
-	glBindTexture(GL_TEXTURE_CUBE_MAP, 0);
+	BindTextureCached(GL_TEXTURE_CUBE_MAP, 0);
 	return cubemapId;
 }
 
@@ -944,12 +1867,33 @@ unsigned int rlLoadTextureCubemap(void *data, int size, int format)
 // NOTE: We don't know safely if internal texture format is the expected one...
 void rlUpdateTexture(unsigned int id, int width, int height, int format, const void *data)
 {
-	glBindTexture(GL_TEXTURE_2D, id);
-	unsigned int glInternalFormat, glFormat, glType;
-	rlGetGlTextureFormats(format, &glInternalFormat, &glFormat, &glType);
-	if ((glInternalFormat != -1) && (format < COMPRESSED_DXT1_RGB))
-	{
-		glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, width, height, glFormat, glType, (unsigned char *)data);
+	rlUpdateTextureRec(id, 0, 0, width, height, format, data);
+}
+
+// Update a rectangle of already loaded texture in GPU with new data
+void rlUpdateTextureRec(unsigned int id, int offsetX, int offsetY, int width, int height, int format, const void *data)
+{
+	if (RenderThreadRecording())
+	{
+		RenderCommand *command = RenderThreadPush(RC_TEXTURE_UPDATE, data, GetPixelDataSize(width, height, format));
+		if (command != NULL)
+		{
+			command->params[0] = id;
+			command->params[1] = offsetX;
+			command->params[2] = offsetY;
+			command->params[3] = width;
+			command->params[4] = height;
+			command->params[5] = format;
+			return;
+		}
+		RenderThreadAcquireContext();   // Command could not be recorded, recorded work is executed and texture updated synchronously
+	}
+	BindTextureCached(GL_TEXTURE_2D, id);
+	unsigned int glInternalFormat, glFormat, glType;
+	rlGetGlTextureFormats(format, &glInternalFormat, &glFormat, &glType);
+	if ((glInternalFormat != -1) && (format < COMPRESSED_DXT1_RGB))
+	{
+		glTexSubImage2D(GL_TEXTURE_2D, 0, offsetX, offsetY, width, height, glFormat, glType, (unsigned char *)data);
 	}
 	else debugNetPrintf(ERROR, "[ORBISGL] %s Texture format updating not supported\n",__FUNCTION__);
 }
@@ -991,13 +1935,16 @@ void rlGetGlTextureFormats(int format, unsigned int *glInternalFormat, unsigned
 // Unload texture from GPU memory
 void rlUnloadTexture(unsigned int id)
 {
+	RenderThreadAcquireContext();
 	if (id > 0) glDeleteTextures(1, &id);
+	ForgetObjectCached(GL_TEXTURE_2D, id);
 }
 
 // Load a texture to be used for rendering (fbo with default color and depth attachments)
 // NOTE: If colorFormat or depthBits are no supported, no attachment is done
 RenderTexture2D rlLoadRenderTexture(int width, int height, int format, int depthBits, bool useDepthTexture)
 {
+	RenderThreadAcquireContext();
 	RenderTexture2D target = { 0 };
 	if (useDepthTexture && RLGL.ExtSupported.texDepth) target.depthTexture = true;
 	// Create the framebuffer object
@@ -1043,6 +1990,7 @@ RenderTexture2D rlLoadRenderTexture(int width, int height, int format, int depth
 // NOTE: Attach type: 0-Color, 1-Depth renderbuffer, 2-Depth texture
 void rlRenderTextureAttach(RenderTexture2D target, unsigned int id, int attachType)
 {
+	RenderThreadAcquireContext();
 	glBindFramebuffer(GL_FRAMEBUFFER, target.id);
 	if (attachType == 0) glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, id, 0);
 	else if (attachType == 1)
@@ -1056,6 +2004,7 @@ void rlRenderTextureAttach(RenderTexture2D target, unsigned int id, int attachTy
 // Verify render texture is complete
 bool rlRenderTextureComplete(RenderTexture target)
 {
+	RenderThreadAcquireContext();
 	bool result = false;
 	glBindFramebuffer(GL_FRAMEBUFFER, target.id);
 	GLenum status = glCheckFramebufferStatus(GL_FRAMEBUFFER);
@@ -1078,7 +2027,8 @@ bool rlRenderTextureComplete(RenderTexture target)
 // Generate mipmap data for selected texture
 void rlGenerateMipmaps(Texture2D *texture)
 {
-	glBindTexture(GL_TEXTURE_2D, texture->id);
+	RenderThreadAcquireContext();
+	BindTextureCached(GL_TEXTURE_2D, texture->id);
 	// Check if texture is power-of-two (POT)
 	bool texIsPOT = false;
 	if (((texture->width > 0) && ((texture->width & (texture->width - 1)) == 0)) &&
@@ -1095,12 +2045,13 @@ void rlGenerateMipmaps(Texture2D *texture)
 		texture->mipmaps =  1 + (int)floor(log(MAX(texture->width, texture->height))/log(2));
 	}
 	else debugNetPrintf(ERROR, "[ORBISGL] %s [TEX ID %i] Mipmaps can not be generated\n",__FUNCTION__,texture->id);
-	glBindTexture(GL_TEXTURE_2D, 0);
+	BindTextureCached(GL_TEXTURE_2D, 0);
 }
 
 // Upload vertex data into a VAO (if supported) and VBO
 void rlLoadMesh(Mesh *mesh, bool dynamic)
 {
+	RenderThreadAcquireContext();
 	if (mesh->vaoId > 0)
 	{
 		// Check if mesh has already been loaded in GPU
@@ -1115,24 +2066,26 @@ void rlLoadMesh(Mesh *mesh, bool dynamic)
 	mesh->vboId[4] = 0;     // Vertex tangents VBO
 	mesh->vboId[5] = 0;     // Vertex texcoords2 VBO
 	mesh->vboId[6] = 0;     // Vertex indices VBO
+	mesh->vboId[7] = 0;     // Vertex bone ids VBO
+	mesh->vboId[8] = 0;     // Vertex bone weights VBO
 	int drawHint = GL_STATIC_DRAW;
 	if (dynamic) drawHint = GL_DYNAMIC_DRAW;
 	if (RLGL.ExtSupported.vao)
 	{
 		// Initialize Quads VAO (Buffer A)
 		glGenVertexArrays(1, &mesh->vaoId);
-		glBindVertexArray(mesh->vaoId);
+		BindVertexArrayCached(mesh->vaoId);
 	}
 	// NOTE: Attributes must be uploaded considering default locations points
 	// Enable vertex attributes: position (shader-location = 0)
 	glGenBuffers(1, &mesh->vboId[0]);
-	glBindBuffer(GL_ARRAY_BUFFER, mesh->vboId[0]);
+	BindBufferCached(GL_ARRAY_BUFFER, mesh->vboId[0]);
 	glBufferData(GL_ARRAY_BUFFER, sizeof(float)*3*mesh->vertexCount, mesh->vertices, drawHint);
 	glVertexAttribPointer(0, 3, GL_FLOAT, 0, 0, 0);
 	glEnableVertexAttribArray(0);
 	// Enable vertex attributes: texcoords (shader-location = 1)
 	glGenBuffers(1, &mesh->vboId[1]);
-	glBindBuffer(GL_ARRAY_BUFFER, mesh->vboId[1]);
+	BindBufferCached(GL_ARRAY_BUFFER, mesh->vboId[1]);
 	glBufferData(GL_ARRAY_BUFFER, sizeof(float)*2*mesh->vertexCount, mesh->texcoords, drawHint);
 	glVertexAttribPointer(1, 2, GL_FLOAT, 0, 0, 0);
 	glEnableVertexAttribArray(1);
@@ -1140,7 +2093,7 @@ void rlLoadMesh(Mesh *mesh, bool dynamic)
 	if (mesh->normals != NULL)
 	{
 		glGenBuffers(1, &mesh->vboId[2]);
-		glBindBuffer(GL_ARRAY_BUFFER, mesh->vboId[2]);
+		BindBufferCached(GL_ARRAY_BUFFER, mesh->vboId[2]);
 		glBufferData(GL_ARRAY_BUFFER, sizeof(float)*3*mesh->vertexCount, mesh->normals, drawHint);
 		glVertexAttribPointer(2, 3, GL_FLOAT, 0, 0, 0);
 		glEnableVertexAttribArray(2);
@@ -1155,7 +2108,7 @@ void rlLoadMesh(Mesh *mesh, bool dynamic)
 	if (mesh->colors != NULL)
 	{
 		glGenBuffers(1, &mesh->vboId[3]);
-		glBindBuffer(GL_ARRAY_BUFFER, mesh->vboId[3]);
+		BindBufferCached(GL_ARRAY_BUFFER, mesh->vboId[3]);
 		glBufferData(GL_ARRAY_BUFFER, sizeof(unsigned char)*4*mesh->vertexCount, mesh->colors, drawHint);
 		glVertexAttribPointer(3, 4, GL_UNSIGNED_BYTE, GL_TRUE, 0, 0);
 		glEnableVertexAttribArray(3);
@@ -1170,7 +2123,7 @@ void rlLoadMesh(Mesh *mesh, bool dynamic)
 	if (mesh->tangents != NULL)
 	{
 		glGenBuffers(1, &mesh->vboId[4]);
-		glBindBuffer(GL_ARRAY_BUFFER, mesh->vboId[4]);
+		BindBufferCached(GL_ARRAY_BUFFER, mesh->vboId[4]);
 		glBufferData(GL_ARRAY_BUFFER, sizeof(float)*4*mesh->vertexCount, mesh->tangents, drawHint);
 		glVertexAttribPointer(4, 4, GL_FLOAT, 0, 0, 0);
 		glEnableVertexAttribArray(4);
@@ -1185,7 +2138,7 @@ void rlLoadMesh(Mesh *mesh, bool dynamic)
 	if (mesh->texcoords2 != NULL)
 	{
 		glGenBuffers(1, &mesh->vboId[5]);
-		glBindBuffer(GL_ARRAY_BUFFER, mesh->vboId[5]);
+		BindBufferCached(GL_ARRAY_BUFFER, mesh->vboId[5]);
 		glBufferData(GL_ARRAY_BUFFER, sizeof(float)*2*mesh->vertexCount, mesh->texcoords2, drawHint);
 		glVertexAttribPointer(5, 2, GL_FLOAT, 0, 0, 0);
 		glEnableVertexAttribArray(5);
@@ -1196,10 +2149,46 @@ void rlLoadMesh(Mesh *mesh, bool dynamic)
 		glVertexAttrib2f(5, 0.0f, 0.0f);
 		glDisableVertexAttribArray(5);
 	}
+	// Bone ids and weights vertex attributes (shader-location = 6, 7), uploaded once for GPU skinning
+	// NOTE: Bone ids are uploaded as bytes, only meshes with up to MAX_SKINNING_BONES bones are skinned on GPU,
+	// ids out of the shader bone matrices get no weight (skipped as CPU skinning does, see SkinMeshVertices()),
+	// weights are normalized by vertex
+	if ((mesh->boneIds != NULL) && (mesh->boneWeights != NULL))
+	{
+		unsigned char *boneIds = (unsigned char *)malloc(4*mesh->vertexCount);
+		float *boneWeights = (float *)malloc(sizeof(float)*4*mesh->vertexCount);
+		if ((boneIds != NULL) && (boneWeights != NULL))
+		{
+			for (int i = 0; i < mesh->vertexCount; i++)
+			{
+				float totalWeight = 0.0f;
+				for (int k = i*4; k < i*4 + 4; k++)
+				{
+					bool valid = ((mesh->boneIds[k] >= 0) && (mesh->boneIds[k] < MAX_SKINNING_BONES));
+					boneIds[k] = valid? mesh->boneIds[k] : 0;
+					boneWeights[k] = valid? mesh->boneWeights[k] : 0.0f;
+					totalWeight += boneWeights[k];
+				}
+				if (totalWeight > 0.0f) for (int k = i*4; k < i*4 + 4; k++) boneWeights[k] /= totalWeight;
+			}
+			glGenBuffers(1, &mesh->vboId[7]);
+			BindBufferCached(GL_ARRAY_BUFFER, mesh->vboId[7]);
+			glBufferData(GL_ARRAY_BUFFER, 4*mesh->vertexCount, boneIds, GL_STATIC_DRAW);
+			glVertexAttribPointer(6, 4, GL_UNSIGNED_BYTE, GL_FALSE, 0, 0);
+			glEnableVertexAttribArray(6);
+			glGenBuffers(1, &mesh->vboId[8]);
+			BindBufferCached(GL_ARRAY_BUFFER, mesh->vboId[8]);
+			glBufferData(GL_ARRAY_BUFFER, sizeof(float)*4*mesh->vertexCount, boneWeights, GL_STATIC_DRAW);
+			glVertexAttribPointer(7, 4, GL_FLOAT, 0, 0, 0);
+			glEnableVertexAttribArray(7);
+		}
+		free(boneIds);
+		free(boneWeights);
+	}
 	if (mesh->indices != NULL)
 	{
 		glGenBuffers(1, &mesh->vboId[6]);
-		glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, mesh->vboId[6]);
+		BindBufferCached(GL_ELEMENT_ARRAY_BUFFER, mesh->vboId[6]);
 		glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(unsigned short)*mesh->triangleCount*3, mesh->indices, drawHint);
 	}
 	if (RLGL.ExtSupported.vao)
@@ -1216,16 +2205,17 @@ void rlLoadMesh(Mesh *mesh, bool dynamic)
 // Load a new attributes buffer
 unsigned int rlLoadAttribBuffer(unsigned int vaoId, int shaderLoc, void *buffer, int size, bool dynamic)
 {
+	RenderThreadAcquireContext();
 	unsigned int id = 0;
 	int drawHint = GL_STATIC_DRAW;
 	if (dynamic) drawHint = GL_DYNAMIC_DRAW;
-	if (RLGL.ExtSupported.vao) glBindVertexArray(vaoId);
+	if (RLGL.ExtSupported.vao) BindVertexArrayCached(vaoId);
 	glGenBuffers(1, &id);
-	glBindBuffer(GL_ARRAY_BUFFER, id);
+	BindBufferCached(GL_ARRAY_BUFFER, id);
 	glBufferData(GL_ARRAY_BUFFER, size, buffer, drawHint);
 	glVertexAttribPointer(shaderLoc, 2, GL_FLOAT, 0, 0, 0);
 	glEnableVertexAttribArray(shaderLoc);
-	if (RLGL.ExtSupported.vao) glBindVertexArray(0);
+	if (RLGL.ExtSupported.vao) BindVertexArrayCached(0);
 	return id;
 }
 
@@ -1240,144 +2230,227 @@ void rlUpdateMesh(Mesh mesh, int buffer, int num)
 //          updated if offset + size exceeds what the buffer can hold
 void rlUpdateMeshAt(Mesh mesh, int buffer, int num, int index)
 {
+	RenderThreadAcquireContext();
 	// Activate mesh VAO
-	if (RLGL.ExtSupported.vao) glBindVertexArray(mesh.vaoId);
+	if (RLGL.ExtSupported.vao) BindVertexArrayCached(mesh.vaoId);
 	switch (buffer)
 	{
 		case 0:     // Update vertices (vertex position)
 		{
-			glBindBuffer(GL_ARRAY_BUFFER, mesh.vboId[0]);
+			BindBufferCached(GL_ARRAY_BUFFER, mesh.vboId[0]);
 			if (index == 0 && num >= mesh.vertexCount) glBufferData(GL_ARRAY_BUFFER, sizeof(float)*3*num, mesh.vertices, GL_DYNAMIC_DRAW);
 			else if (index + num >= mesh.vertexCount) break;
-			else glBufferSubData(GL_ARRAY_BUFFER, sizeof(float)*3*index, sizeof(float)*3*num, mesh.vertices);
+			else
+			{
+				glBufferSubData(GL_ARRAY_BUFFER, sizeof(float)*3*index, sizeof(float)*3*num, mesh.vertices);
+				RLGL.State.frameStats.bytesUploaded += sizeof(float)*3*num;
+			}
 		} break;
 		case 1:     // Update texcoords (vertex texture coordinates)
 		{
-			glBindBuffer(GL_ARRAY_BUFFER, mesh.vboId[1]);
+			BindBufferCached(GL_ARRAY_BUFFER, mesh.vboId[1]);
 			if (index == 0 && num >= mesh.vertexCount) glBufferData(GL_ARRAY_BUFFER, sizeof(float)*2*num, mesh.texcoords, GL_DYNAMIC_DRAW);
 			else if (index + num >= mesh.vertexCount) break;
-			else glBufferSubData(GL_ARRAY_BUFFER, sizeof(float)*2*index, sizeof(float)*2*num, mesh.texcoords);
+			else
+			{
+				glBufferSubData(GL_ARRAY_BUFFER, sizeof(float)*2*index, sizeof(float)*2*num, mesh.texcoords);
+				RLGL.State.frameStats.bytesUploaded += sizeof(float)*2*num;
+			}
 		} break;
 		case 2:     // Update normals (vertex normals)
 		{
-			glBindBuffer(GL_ARRAY_BUFFER, mesh.vboId[2]);
+			BindBufferCached(GL_ARRAY_BUFFER, mesh.vboId[2]);
 			if (index == 0 && num >= mesh.vertexCount) glBufferData(GL_ARRAY_BUFFER, sizeof(float)*3*num, mesh.normals, GL_DYNAMIC_DRAW);
 			else if (index + num >= mesh.vertexCount) break;
-			else glBufferSubData(GL_ARRAY_BUFFER, sizeof(float)*3*index, sizeof(float)*3*num, mesh.normals);
+			else
+			{
+				glBufferSubData(GL_ARRAY_BUFFER, sizeof(float)*3*index, sizeof(float)*3*num, mesh.normals);
+				RLGL.State.frameStats.bytesUploaded += sizeof(float)*3*num;
+			}
 		} break;
 		case 3:     // Update colors (vertex colors)
 		{
-			glBindBuffer(GL_ARRAY_BUFFER, mesh.vboId[3]);
+			BindBufferCached(GL_ARRAY_BUFFER, mesh.vboId[3]);
 			if (index == 0 && num >= mesh.vertexCount) glBufferData(GL_ARRAY_BUFFER, sizeof(float)*4*num, mesh.colors, GL_DYNAMIC_DRAW);
 			else if (index + num >= mesh.vertexCount) break;
-			else glBufferSubData(GL_ARRAY_BUFFER, sizeof(unsigned char)*4*index, sizeof(unsigned char)*4*num, mesh.colors);
+			else
+			{
+				glBufferSubData(GL_ARRAY_BUFFER, sizeof(unsigned char)*4*index, sizeof(unsigned char)*4*num, mesh.colors);
+				RLGL.State.frameStats.bytesUploaded += sizeof(unsigned char)*4*num;
+			}
 		} break;
 		case 4:     // Update tangents (vertex tangents)
 		{
-			glBindBuffer(GL_ARRAY_BUFFER, mesh.vboId[4]);
+			BindBufferCached(GL_ARRAY_BUFFER, mesh.vboId[4]);
 			if (index == 0 && num >= mesh.vertexCount) glBufferData(GL_ARRAY_BUFFER, sizeof(float)*4*num, mesh.tangents, GL_DYNAMIC_DRAW);
 			else if (index + num >= mesh.vertexCount) break;
-			else glBufferSubData(GL_ARRAY_BUFFER, sizeof(float)*4*index, sizeof(float)*4*num, mesh.tangents);
+			else
+			{
+				glBufferSubData(GL_ARRAY_BUFFER, sizeof(float)*4*index, sizeof(float)*4*num, mesh.tangents);
+				RLGL.State.frameStats.bytesUploaded += sizeof(float)*4*num;
+			}
 		} break;
 		case 5:     // Update texcoords2 (vertex second texture coordinates)
 		{
-			glBindBuffer(GL_ARRAY_BUFFER, mesh.vboId[5]);
+			BindBufferCached(GL_ARRAY_BUFFER, mesh.vboId[5]);
 			if (index == 0 && num >= mesh.vertexCount) glBufferData(GL_ARRAY_BUFFER, sizeof(float)*2*num, mesh.texcoords2, GL_DYNAMIC_DRAW);
 			else if (index + num >= mesh.vertexCount) break;
-			else glBufferSubData(GL_ARRAY_BUFFER, sizeof(float)*2*index, sizeof(float)*2*num, mesh.texcoords2);
+			else
+			{
+				glBufferSubData(GL_ARRAY_BUFFER, sizeof(float)*2*index, sizeof(float)*2*num, mesh.texcoords2);
+				RLGL.State.frameStats.bytesUploaded += sizeof(float)*2*num;
+			}
 		} break;
 		case 6:     // Update indices (triangle index buffer)
 		{
 			// the * 3 is because each triangle has 3 indices
 			unsigned short *indices = mesh.indices;
-			glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, mesh.vboId[6]);
+			BindBufferCached(GL_ELEMENT_ARRAY_BUFFER, mesh.vboId[6]);
 			if (index == 0 && num >= mesh.triangleCount)
 				glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(*indices)*num*3, indices, GL_DYNAMIC_DRAW);
 			else if (index + num >= mesh.triangleCount)
 				break;
 			else
+			{
 				glBufferSubData(GL_ELEMENT_ARRAY_BUFFER, sizeof(*indices)*index*3, sizeof(*indices)*num*3, indices);
+				RLGL.State.frameStats.bytesUploaded += sizeof(*indices)*num*3;
+			}
 		} break;
 		default: break;
 	}
 	// Unbind the current VAO
-	if (RLGL.ExtSupported.vao) glBindVertexArray(0);
+	if (RLGL.ExtSupported.vao) BindVertexArrayCached(0);
 	// Another option would be using buffer mapping...
 	//mesh.vertices = glMapBuffer(GL_ARRAY_BUFFER, GL_READ_WRITE);
 	// Now we can modify vertices
 	//glUnmapBuffer(GL_ARRAY_BUFFER);
 }
 
+// Get shader to draw a mesh with a material: material shader variant for mesh features (compiled on first use)
+// NOTE: GPU skinned meshes drawn with default shader use its skinning variant
+static Shader GetMeshDrawShader(Mesh mesh, Material material, bool skinned)
+{
+	if (material.variants.programs != NULL)
+	{
+		unsigned int features = (material.variants.features | GetMeshShaderFeatures(mesh, material)) & ~SHADER_FEATURE_SKINNING;
+		return GetShaderVariant(material.variants, skinned? (features | SHADER_FEATURE_SKINNING) : features);
+	}
+	if (skinned && (material.shader.id == RLGL.State.defaultShader.id))
+	{
+		if (defaultVariants.programs == NULL) defaultVariants = LoadShaderVariantsCode(NULL, NULL);
+		return GetShaderVariant(defaultVariants, SHADER_FEATURE_SKINNING);
+	}
+	return material.shader;
+}
+
+// Check if mesh can be skinned on GPU when drawn with material: bone buffers loaded and
+// shader picked for drawing provides bone matrices and bone attributes
+bool rlCheckGpuSkinning(Mesh mesh, Material material)
+{
+	if ((mesh.vboId == NULL) || (mesh.vboId[7] == 0) || (mesh.vboId[8] == 0)) return false;
+	Shader shader = GetMeshDrawShader(mesh, material, true);
+	if (shader.locs == NULL) return false;
+	return ((shader.locs[LOC_MATRIX_BONES] != -1) && (shader.locs[LOC_VERTEX_BONEIDS] != -1) && (shader.locs[LOC_VERTEX_BONEWEIGHTS] != -1));
+}
+
 // Draw a 3d mesh with material and transform
 void rlDrawMesh(Mesh mesh, Material material, Matrix transform)
+{
+	BeginProfileScope("rlDrawMesh");
+	// At this point the modelview matrix just contains the view matrix (camera)
+	// That's because BeginMode3D() sets it an no model-drawing function modifies it, all use rlPushMatrix() and rlPopMatrix()
+	// NOTE: Transform (rlPushMatrix() state), view and projection product is cached, one multiply per mesh
+	Matrix matMVP = MatrixMultiply(transform, GetMeshViewProjection());
+	material.shader = GetMeshDrawShader(mesh, material, (mesh.boneMatrices != NULL));
+	FlushShaderDraws(material.shader.id);   // Mesh uniforms must not change batched draws of same shader
+	if (RenderThreadRecording()) RenderThreadRecordMesh(mesh, material, transform, RLGL.State.modelview, RLGL.State.projection, matMVP);
+	else DrawMeshDefault(mesh, material, transform, RLGL.State.modelview, RLGL.State.projection, matMVP);
+	RLGL.State.frameStats.drawCalls++;
+	RLGL.State.frameStats.meshDraws++;
+	EndProfileScope();
+}
+
+// Draw a 3d mesh with material and matrices provided
+// NOTE: Used by rlDrawMesh() and by render thread, RLGL.State matrices and batch are not accessed
+void DrawMeshDefault(Mesh mesh, Material material, Matrix matModel, Matrix matView, Matrix matProjection, Matrix matMVP)
 {
 	// Bind shader program
-	glUseProgram(material.shader.id);
+	UseProgramCached(material.shader.id);
 	// Matrices and other values required by shader
 	//-----------------------------------------------------
 	// Calculate and send to shader model matrix (used by PBR shader)
-	if (material.shader.locs[LOC_MATRIX_MODEL] != -1) SetShaderValueMatrix(material.shader, material.shader.locs[LOC_MATRIX_MODEL], transform);
+	if (material.shader.locs[LOC_MATRIX_MODEL] != -1) SetUniformCached(material.shader.id, material.shader.locs[LOC_MATRIX_MODEL], UNIFORM_MATRIX, MatrixToFloatV(matModel).v, 1);
 	// Upload to shader material.colDiffuse
 	if (material.shader.locs[LOC_COLOR_DIFFUSE] != -1)
-		glUniform4f(material.shader.locs[LOC_COLOR_DIFFUSE],(float)material.maps[MAP_DIFFUSE].color.r/255.0f,
-															(float)material.maps[MAP_DIFFUSE].color.g/255.0f,
-															(float)material.maps[MAP_DIFFUSE].color.b/255.0f,
-															(float)material.maps[MAP_DIFFUSE].color.a/255.0f);
+	{
+		float color[4] = { (float)material.maps[MAP_DIFFUSE].color.r/255.0f, (float)material.maps[MAP_DIFFUSE].color.g/255.0f,
+						   (float)material.maps[MAP_DIFFUSE].color.b/255.0f, (float)material.maps[MAP_DIFFUSE].color.a/255.0f };
+		SetUniformCached(material.shader.id, material.shader.locs[LOC_COLOR_DIFFUSE], UNIFORM_VEC4, color, 1);
+	}
 	// Upload to shader material.colSpecular (if available)
 	if (material.shader.locs[LOC_COLOR_SPECULAR] != -1)
-		glUniform4f(material.shader.locs[LOC_COLOR_SPECULAR],(float)material.maps[MAP_SPECULAR].color.r/255.0f,
-															(float)material.maps[MAP_SPECULAR].color.g/255.0f,
-															(float)material.maps[MAP_SPECULAR].color.b/255.0f,
-															(float)material.maps[MAP_SPECULAR].color.a/255.0f);
-	if (material.shader.locs[LOC_MATRIX_VIEW] != -1) SetShaderValueMatrix(material.shader, material.shader.locs[LOC_MATRIX_VIEW], RLGL.State.modelview);
-	if (material.shader.locs[LOC_MATRIX_PROJECTION] != -1) SetShaderValueMatrix(material.shader, material.shader.locs[LOC_MATRIX_PROJECTION], RLGL.State.projection);
-	// At this point the modelview matrix just contains the view matrix (camera)
-	// That's because BeginMode3D() sets it an no model-drawing function modifies it, all use rlPushMatrix() and rlPopMatrix()
-	Matrix matView = RLGL.State.modelview;         // View matrix (camera)
-	Matrix matProjection = RLGL.State.projection;  // Projection matrix (perspective)
-	// TODO: Consider possible transform matrices in the RLGL.State.stack
-	// Is this the right order? or should we start with the first stored matrix instead of the last one?
-	//Matrix matStackTransform = MatrixIdentity();
-	//for (int i = RLGL.State.stackCounter; i > 0; i--) matStackTransform = MatrixMultiply(RLGL.State.stack[i], matStackTransform);
-	// Transform to camera-space coordinates
-	Matrix matModelView = MatrixMultiply(transform, MatrixMultiply(RLGL.State.transform, matView));
+	{
+		float color[4] = { (float)material.maps[MAP_SPECULAR].color.r/255.0f, (float)material.maps[MAP_SPECULAR].color.g/255.0f,
+						   (float)material.maps[MAP_SPECULAR].color.b/255.0f, (float)material.maps[MAP_SPECULAR].color.a/255.0f };
+		SetUniformCached(material.shader.id, material.shader.locs[LOC_COLOR_SPECULAR], UNIFORM_VEC4, color, 1);
+	}
+	if (material.shader.locs[LOC_MATRIX_VIEW] != -1) SetUniformCached(material.shader.id, material.shader.locs[LOC_MATRIX_VIEW], UNIFORM_MATRIX, MatrixToFloatV(matView).v, 1);
+	if (material.shader.locs[LOC_MATRIX_PROJECTION] != -1) SetUniformCached(material.shader.id, material.shader.locs[LOC_MATRIX_PROJECTION], UNIFORM_MATRIX, MatrixToFloatV(matProjection).v, 1);
+	// Upload bone matrices of GPU skinned mesh
+	if ((mesh.boneMatrices != NULL) && (material.shader.locs[LOC_MATRIX_BONES] != -1)) SetUniformCached(material.shader.id, material.shader.locs[LOC_MATRIX_BONES], UNIFORM_VEC4, mesh.boneMatrices, mesh.boneCount*3);
 	//-----------------------------------------------------
 	// Bind active texture maps (if available)
 	for (int i = 0; i < MAX_MATERIAL_MAPS; i++)
 	{
 		if (material.maps[i].texture.id > 0)
 		{
-			glActiveTexture(GL_TEXTURE0 + i);
-			if ((i == MAP_IRRADIANCE) || (i == MAP_PREFILTER) || (i == MAP_CUBEMAP)) glBindTexture(GL_TEXTURE_CUBE_MAP, material.maps[i].texture.id);
-			else glBindTexture(GL_TEXTURE_2D, material.maps[i].texture.id);
-			glUniform1i(material.shader.locs[LOC_MAP_DIFFUSE + i], i);
+			ActiveTextureCached(i);
+			if ((i == MAP_IRRADIANCE) || (i == MAP_PREFILTER) || (i == MAP_CUBEMAP)) BindTextureCached(GL_TEXTURE_CUBE_MAP, material.maps[i].texture.id);
+			else BindTextureCached(GL_TEXTURE_2D, material.maps[i].texture.id);
+			SetUniformCached(material.shader.id, material.shader.locs[LOC_MAP_DIFFUSE + i], UNIFORM_INT, &i, 1);
+		}
+		else if ((RLGL.Cache.texture2D[i] != 0) || (RLGL.Cache.textureCube[i] != 0))
+		{
+			// Unbind texture left by a previous draw on unused map unit
+			ActiveTextureCached(i);
+			if ((i == MAP_IRRADIANCE) || (i == MAP_PREFILTER) || (i == MAP_CUBEMAP)) BindTextureCached(GL_TEXTURE_CUBE_MAP, 0);
+			else BindTextureCached(GL_TEXTURE_2D, 0);
 		}
 	}
 	// Bind vertex array objects (or VBOs)
-	if (RLGL.ExtSupported.vao) glBindVertexArray(mesh.vaoId);
+	if (RLGL.ExtSupported.vao) BindVertexArrayCached(mesh.vaoId);
 	else
 	{
 		// Bind mesh VBO data: vertex position (shader-location = 0)
-		glBindBuffer(GL_ARRAY_BUFFER, mesh.vboId[0]);
+		BindBufferCached(GL_ARRAY_BUFFER, mesh.vboId[0]);
 		glVertexAttribPointer(material.shader.locs[LOC_VERTEX_POSITION], 3, GL_FLOAT, 0, 0, 0);
 		glEnableVertexAttribArray(material.shader.locs[LOC_VERTEX_POSITION]);
 		// Bind mesh VBO data: vertex texcoords (shader-location = 1)
-		glBindBuffer(GL_ARRAY_BUFFER, mesh.vboId[1]);
+		BindBufferCached(GL_ARRAY_BUFFER, mesh.vboId[1]);
 		glVertexAttribPointer(material.shader.locs[LOC_VERTEX_TEXCOORD01], 2, GL_FLOAT, 0, 0, 0);
 		glEnableVertexAttribArray(material.shader.locs[LOC_VERTEX_TEXCOORD01]);
 		// Bind mesh VBO data: vertex normals (shader-location = 2, if available)
 		if (material.shader.locs[LOC_VERTEX_NORMAL] != -1)
 		{
-			glBindBuffer(GL_ARRAY_BUFFER, mesh.vboId[2]);
-			glVertexAttribPointer(material.shader.locs[LOC_VERTEX_NORMAL], 3, GL_FLOAT, 0, 0, 0);
-			glEnableVertexAttribArray(material.shader.locs[LOC_VERTEX_NORMAL]);
+			if (mesh.vboId[2] != 0)
+			{
+				BindBufferCached(GL_ARRAY_BUFFER, mesh.vboId[2]);
+				glVertexAttribPointer(material.shader.locs[LOC_VERTEX_NORMAL], 3, GL_FLOAT, 0, 0, 0);
+				glEnableVertexAttribArray(material.shader.locs[LOC_VERTEX_NORMAL]);
+			}
+			else
+			{
+				// Set default value for unused attribute (skinning variant of default shader reads normals)
+				glVertexAttrib3f(material.shader.locs[LOC_VERTEX_NORMAL], 0.0f, 0.0f, 1.0f);
+				glDisableVertexAttribArray(material.shader.locs[LOC_VERTEX_NORMAL]);
+			}
 		}
 		// Bind mesh VBO data: vertex colors (shader-location = 3, if available)
 		if (material.shader.locs[LOC_VERTEX_COLOR] != -1)
 		{
 			if (mesh.vboId[3] != 0)
 			{
-				glBindBuffer(GL_ARRAY_BUFFER, mesh.vboId[3]);
+				BindBufferCached(GL_ARRAY_BUFFER, mesh.vboId[3]);
 				glVertexAttribPointer(material.shader.locs[LOC_VERTEX_COLOR], 4, GL_UNSIGNED_BYTE, GL_TRUE, 0, 0);
 				glEnableVertexAttribArray(material.shader.locs[LOC_VERTEX_COLOR]);
 			}
@@ -1392,57 +2465,57 @@ void rlDrawMesh(Mesh mesh, Material material, Matrix transform)
 		// Bind mesh VBO data: vertex tangents (shader-location = 4, if available)
 		if (material.shader.locs[LOC_VERTEX_TANGENT] != -1)
 		{
-			glBindBuffer(GL_ARRAY_BUFFER, mesh.vboId[4]);
+			BindBufferCached(GL_ARRAY_BUFFER, mesh.vboId[4]);
 			glVertexAttribPointer(material.shader.locs[LOC_VERTEX_TANGENT], 4, GL_FLOAT, 0, 0, 0);
 			glEnableVertexAttribArray(material.shader.locs[LOC_VERTEX_TANGENT]);
 		}
 		// Bind mesh VBO data: vertex texcoords2 (shader-location = 5, if available)
 		if (material.shader.locs[LOC_VERTEX_TEXCOORD02] != -1)
 		{
-			glBindBuffer(GL_ARRAY_BUFFER, mesh.vboId[5]);
+			BindBufferCached(GL_ARRAY_BUFFER, mesh.vboId[5]);
 			glVertexAttribPointer(material.shader.locs[LOC_VERTEX_TEXCOORD02], 2, GL_FLOAT, 0, 0, 0);
 			glEnableVertexAttribArray(material.shader.locs[LOC_VERTEX_TEXCOORD02]);
 		}
-		if (mesh.indices != NULL) glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, mesh.vboId[6]);
+		// Bind mesh VBO data: vertex bone ids and weights (shader-location = 6, 7, if available)
+		if ((material.shader.locs[LOC_VERTEX_BONEIDS] != -1) && (mesh.vboId[7] != 0))
+		{
+			BindBufferCached(GL_ARRAY_BUFFER, mesh.vboId[7]);
+			glVertexAttribPointer(material.shader.locs[LOC_VERTEX_BONEIDS], 4, GL_UNSIGNED_BYTE, GL_FALSE, 0, 0);
+			glEnableVertexAttribArray(material.shader.locs[LOC_VERTEX_BONEIDS]);
+		}
+		if ((material.shader.locs[LOC_VERTEX_BONEWEIGHTS] != -1) && (mesh.vboId[8] != 0))
+		{
+			BindBufferCached(GL_ARRAY_BUFFER, mesh.vboId[8]);
+			glVertexAttribPointer(material.shader.locs[LOC_VERTEX_BONEWEIGHTS], 4, GL_FLOAT, 0, 0, 0);
+			glEnableVertexAttribArray(material.shader.locs[LOC_VERTEX_BONEWEIGHTS]);
+		}
+		if (mesh.indices != NULL) BindBufferCached(GL_ELEMENT_ARRAY_BUFFER, mesh.vboId[6]);
 	}
 	int eyesCount = 1;
 	for (int eye = 0; eye < eyesCount; eye++)
 	{
-		if (eyesCount == 1) RLGL.State.modelview = matModelView;
-		
-		// Calculate model-view-projection matrix (MVP)
-		Matrix matMVP = MatrixMultiply(RLGL.State.modelview, RLGL.State.projection);        // Transform to screen-space coordinates
 		// Send combined model-view-projection matrix to shader
-		glUniformMatrix4fv(material.shader.locs[LOC_MATRIX_MVP], 1, false, MatrixToFloat(matMVP));
+		SetUniformCached(material.shader.id, material.shader.locs[LOC_MATRIX_MVP], UNIFORM_MATRIX, MatrixToFloatV(matMVP).v, 1);
 		// Draw call!
 		if (mesh.indices != NULL) glDrawElements(GL_TRIANGLES, mesh.triangleCount*3, GL_UNSIGNED_SHORT, 0); // Indexed vertices draw
 		else glDrawArrays(GL_TRIANGLES, 0, mesh.vertexCount);
 	}
-	// Unbind all binded texture maps
-	for (int i = 0; i < MAX_MATERIAL_MAPS; i++)
-	{
-		glActiveTexture(GL_TEXTURE0 + i);       // Set shader active texture
-		if ((i == MAP_IRRADIANCE) || (i == MAP_PREFILTER) || (i == MAP_CUBEMAP)) glBindTexture(GL_TEXTURE_CUBE_MAP, 0);
-		else glBindTexture(GL_TEXTURE_2D, 0);   // Unbind current active texture
-	}
+	// NOTE: Texture maps and shader program are kept bound, state cache skips
+	// rebinding them when next mesh uses the same material
+	ActiveTextureCached(0);
 	// Unind vertex array objects (or VBOs)
-	if (RLGL.ExtSupported.vao) glBindVertexArray(0);
+	if (RLGL.ExtSupported.vao) BindVertexArrayCached(0);
 	else
 	{
-		glBindBuffer(GL_ARRAY_BUFFER, 0);
-		if (mesh.indices != NULL) glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+		BindBufferCached(GL_ARRAY_BUFFER, 0);
+		if (mesh.indices != NULL) BindBufferCached(GL_ELEMENT_ARRAY_BUFFER, 0);
 	}
-	// Unbind shader program
-	glUseProgram(0);
-	// Restore RLGL.State.projection/RLGL.State.modelview matrices
-	// NOTE: In stereo rendering matrices are being modified to fit every eye
-	RLGL.State.projection = matProjection;
-	RLGL.State.modelview = matView;
 }
 
 // Unload mesh data from CPU and GPU
 void rlUnloadMesh(Mesh mesh)
 {
+	RenderThreadAcquireContext();
 	free(mesh.vertices);
 	free(mesh.texcoords);
 	free(mesh.normals);
@@ -1454,6 +2527,7 @@ void rlUnloadMesh(Mesh mesh)
 	free(mesh.animNormals);
 	free(mesh.boneWeights);
 	free(mesh.boneIds);
+	free(mesh.boneMatrices);
 	rlDeleteBuffers(mesh.vboId[0]);   // vertex
 	rlDeleteBuffers(mesh.vboId[1]);   // texcoords
 	rlDeleteBuffers(mesh.vboId[2]);   // normals
@@ -1461,12 +2535,15 @@ void rlUnloadMesh(Mesh mesh)
 	rlDeleteBuffers(mesh.vboId[4]);   // tangents
 	rlDeleteBuffers(mesh.vboId[5]);   // texcoords2
 	rlDeleteBuffers(mesh.vboId[6]);   // indices
+	rlDeleteBuffers(mesh.vboId[7]);   // bone ids
+	rlDeleteBuffers(mesh.vboId[8]);   // bone weights
 	rlDeleteVertexArrays(mesh.vaoId);
 }
 
 // Read screen pixel data (color buffer)
 unsigned char *rlReadScreenPixels(int width, int height)
 {
+	RenderThreadAcquireContext();
 	unsigned char *screenData = (unsigned char *)calloc(width*height*4, sizeof(unsigned char));
 	// NOTE 1: glReadPixels returns image flipped vertically -> (0,0) is the bottom left corner of the framebuffer
 	// NOTE 2: We are getting alpha channel! Be careful, it can be transparent if not cleared properly!
@@ -1490,6 +2567,7 @@ unsigned char *rlReadScreenPixels(int width, int height)
 // Read texture pixel data
 void *rlReadTexturePixels(Texture2D texture)
 {
+	RenderThreadAcquireContext();
 	void *pixels = NULL;
 	// glGetTexImage() is not available on OpenGL ES 2.0
 	// Texture2D width and height are required on OpenGL ES 2.0. There is no way to get it from texture id.
@@ -1500,7 +2578,7 @@ void *rlReadTexturePixels(Texture2D texture)
 	// NOTE: This behaviour could be conditioned by graphic driver...
 	RenderTexture2D fbo = rlLoadRenderTexture(texture.width, texture.height, UNCOMPRESSED_R8G8B8A8, 16, false);
 	glBindFramebuffer(GL_FRAMEBUFFER, fbo.id);
-	glBindTexture(GL_TEXTURE_2D, 0);
+	BindTextureCached(GL_TEXTURE_2D, 0);
 	// Attach our texture to FBO
 	// NOTE: Previoust attached texture is automatically detached
 	glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, texture.id, 0);
@@ -1581,33 +2659,52 @@ Shader LoadShader(const char *vsFileName, const char *fsFileName)
 // NOTE: If shader string is NULL, using default vertex/fragment shaders
 Shader LoadShaderCode(const char *vsCode, const char *fsCode)
 {
+	RenderThreadAcquireContext();
 	Shader shader = { 0 };
 	shader.locs = (int *)calloc(MAX_SHADER_LOCATIONS, sizeof(int));
 	// NOTE: All locations must be reseted to -1 (no location)
 	for (int i = 0; i < MAX_SHADER_LOCATIONS; i++) shader.locs[i] = -1;
-	unsigned int vertexShaderId = RLGL.State.defaultVShaderId;
-	unsigned int fragmentShaderId = RLGL.State.defaultFShaderId;
-	debugNetPrintf(INFO,"[ORBISGL] %s vid=%d fid=%d\n",__FUNCTION__,vertexShaderId,fragmentShaderId);
-
-	if (vsCode != NULL) vertexShaderId = CompileShader(vsCode, GL_VERTEX_SHADER);
-	debugNetPrintf(INFO,"[ORBISGL] %s vid=%d fid=%d\n",__FUNCTION__,vertexShaderId,fragmentShaderId);
-	if (fsCode != NULL) fragmentShaderId = CompileShader(fsCode, GL_FRAGMENT_SHADER);
-	debugNetPrintf(INFO,"[ORBISGL] %s vid=%d fid=%d\n",__FUNCTION__,vertexShaderId,fragmentShaderId);
-
-	if ((vertexShaderId == RLGL.State.defaultVShaderId) && (fragmentShaderId == RLGL.State.defaultFShaderId)) shader = RLGL.State.defaultShader;
+	BeginProfileScope("LoadShaderCode");
+	// NOTE: Program binary cache skips compile and link, missing sources are default shader ones
+	double startTime = GetTime();
+	if ((vsCode != NULL) || (fsCode != NULL)) shader.id = LoadProgramBinaryCached((vsCode != NULL)? vsCode : defaultVShaderCode, (fsCode != NULL)? fsCode : defaultFShaderCode);
+	if (shader.id > 0)
+	{
+		debugNetPrintf(INFO, "[ORBISGL] %s [SHDR ID %i] Program loaded from cache in %.2f ms\n",__FUNCTION__, shader.id, (GetTime() - startTime)*1000.0);
+		SetShaderDefaultLocations(&shader);
+	}
 	else
 	{
-		shader.id = LoadShaderProgram(vertexShaderId, fragmentShaderId);
-		if (vertexShaderId != RLGL.State.defaultVShaderId) glDeleteShader(vertexShaderId);
-		if (fragmentShaderId != RLGL.State.defaultFShaderId) glDeleteShader(fragmentShaderId);
-		if (shader.id == 0)
+		unsigned int vertexShaderId = RLGL.State.defaultVShaderId;
+		unsigned int fragmentShaderId = RLGL.State.defaultFShaderId;
+		debugNetPrintf(INFO,"[ORBISGL] %s vid=%d fid=%d\n",__FUNCTION__,vertexShaderId,fragmentShaderId);
+
+		if (vsCode != NULL) vertexShaderId = CompileShader(vsCode, GL_VERTEX_SHADER);
+		debugNetPrintf(INFO,"[ORBISGL] %s vid=%d fid=%d\n",__FUNCTION__,vertexShaderId,fragmentShaderId);
+		if (fsCode != NULL) fragmentShaderId = CompileShader(fsCode, GL_FRAGMENT_SHADER);
+		debugNetPrintf(INFO,"[ORBISGL] %s vid=%d fid=%d\n",__FUNCTION__,vertexShaderId,fragmentShaderId);
+
+		if ((vertexShaderId == RLGL.State.defaultVShaderId) && (fragmentShaderId == RLGL.State.defaultFShaderId)) shader = RLGL.State.defaultShader;
+		else
 		{
-			debugNetPrintf(ERROR, "[ORBISGL] %s Custom shader could not be loaded\n",__FUNCTION__);
-			shader = RLGL.State.defaultShader;
+			shader.id = LoadShaderProgram(vertexShaderId, fragmentShaderId);
+			if (vertexShaderId != RLGL.State.defaultVShaderId) glDeleteShader(vertexShaderId);
+			if (fragmentShaderId != RLGL.State.defaultFShaderId) glDeleteShader(fragmentShaderId);
+			if (shader.id == 0)
+			{
+				debugNetPrintf(ERROR, "[ORBISGL] %s Custom shader could not be loaded\n",__FUNCTION__);
+				shader = RLGL.State.defaultShader;
+			}
+			else
+			{
+				debugNetPrintf(INFO, "[ORBISGL] %s [SHDR ID %i] Program compiled in %.2f ms\n",__FUNCTION__, shader.id, (GetTime() - startTime)*1000.0);
+				SaveProgramBinaryCached(shader.id, (vsCode != NULL)? vsCode : defaultVShaderCode, (fsCode != NULL)? fsCode : defaultFShaderCode);
+			}
+			// After shader loading, we TRY to set default location names
+			if (shader.id > 0) SetShaderDefaultLocations(&shader);
 		}
-		// After shader loading, we TRY to set default location names
-		if (shader.id > 0) SetShaderDefaultLocations(&shader);
 	}
+	EndProfileScope();
 	// Get available shader uniforms
 	// NOTE: This information is useful for debug...
 	int uniformCount = -1;
@@ -1637,13 +2734,217 @@ void UnloadShader(Shader shader)
 	free(shader.locs);
 }
 
+// Set directory to store program binaries, following shader loads try cached binaries first
+// NOTE: Can be set before InitWindow(), it is ignored without GL_OES_get_program_binary support
+void SetShaderCacheDirectory(const char *path)
+{
+	free(shaderCacheDirectory);
+	shaderCacheDirectory = NULL;
+	if (path != NULL)
+	{
+		shaderCacheDirectory = (char *)malloc(strlen(path) + 1);
+		strcpy(shaderCacheDirectory, path);
+	}
+}
+
+// Load shader files to compile features variants from
+// NOTE: If shader file is NULL, default vertex/fragment shader code is used
+ShaderVariants LoadShaderVariants(const char *vsFileName, const char *fsFileName)
+{
+	char *vShaderStr = NULL;
+	char *fShaderStr = NULL;
+	if (vsFileName != NULL) vShaderStr = LoadFileText(vsFileName);
+	if (fsFileName != NULL) fShaderStr = LoadFileText(fsFileName);
+	ShaderVariants variants = LoadShaderVariantsCode(vShaderStr, fShaderStr);
+	if (vShaderStr != NULL) free(vShaderStr);
+	if (fShaderStr != NULL) free(fShaderStr);
+	return variants;
+}
+
+// Load shader code strings to compile features variants from
+// NOTE: No program is compiled here, every variant compiles on first GetShaderVariant() request
+ShaderVariants LoadShaderVariantsCode(const char *vsCode, const char *fsCode)
+{
+	ShaderVariants variants = { 0 };
+	if (vsCode == NULL) vsCode = defaultVShaderCode;
+	if (fsCode == NULL) fsCode = defaultFShaderCode;
+	variants.vsCode = (char *)malloc(strlen(vsCode) + 1);
+	variants.fsCode = (char *)malloc(strlen(fsCode) + 1);
+	variants.programs = (Shader *)calloc(MAX_SHADER_VARIANTS, sizeof(Shader));
+	variants.uniforms = (ShaderVariantsUniforms *)calloc(1, sizeof(ShaderVariantsUniforms));
+	if ((variants.vsCode == NULL) || (variants.fsCode == NULL) || (variants.programs == NULL) || (variants.uniforms == NULL))
+	{
+		debugNetPrintf(ERROR, "[ORBISGL] %s Shader variants could not be allocated\n",__FUNCTION__);
+		UnloadShaderVariants(variants);
+		return (ShaderVariants){ 0 };
+	}
+	strcpy(variants.vsCode, vsCode);
+	strcpy(variants.fsCode, fsCode);
+	return variants;
+}
+
+// Get variant for a features set, sources are compiled with features defines on first request
+// NOTE: Variants compiled later get uniform values set with SetShaderVariantsValue()
+Shader GetShaderVariant(ShaderVariants variants, unsigned int features)
+{
+	if (variants.programs == NULL) return RLGL.State.defaultShader;
+	features &= (MAX_SHADER_VARIANTS - 1);
+	if (variants.programs[features].id == 0)
+	{
+		char *vsCode = LoadShaderVariantCode(variants.vsCode, features);
+		char *fsCode = LoadShaderVariantCode(variants.fsCode, features);
+		if ((vsCode != NULL) && (fsCode != NULL))
+		{
+			variants.programs[features] = LoadShaderCode(vsCode, fsCode);
+			debugNetPrintf(INFO, "[ORBISGL] %s [SHDR ID %i] Shader variant 0x%02x loaded\n",__FUNCTION__, variants.programs[features].id, features);
+			if ((variants.uniforms != NULL) && (variants.programs[features].id != RLGL.State.defaultShader.id))
+			{
+				for (int i = 0; i < variants.uniforms->count; i++)
+				{
+					VariantUniform *uniform = &variants.uniforms->values[i];
+					if (uniform->value == NULL) continue;
+					int location = GetShaderLocation(variants.programs[features], uniform->name);
+					if (location != -1) SetShaderValueV(variants.programs[features], location, uniform->value, uniform->type, uniform->count);
+				}
+			}
+		}
+		else variants.programs[features] = RLGL.State.defaultShader;
+		free(vsCode);
+		free(fsCode);
+	}
+	return variants.programs[features];
+}
+
+// Get variant features required to draw a mesh with a material
+// NOTE: Features not provided by mesh or material (i.e. SHADER_FEATURE_FOG) are set on ShaderVariants.features,
+// skinning is required by meshes with bone matrices set (GPU skinning)
+unsigned int GetMeshShaderFeatures(Mesh mesh, Material material)
+{
+	unsigned int features = 0;
+	if (mesh.colors != NULL) features |= SHADER_FEATURE_VERTEX_COLOR;
+	if (mesh.boneMatrices != NULL) features |= SHADER_FEATURE_SKINNING;
+	if (material.maps != NULL)
+	{
+		if ((material.maps[MAP_NORMAL].texture.id > 0) && (mesh.tangents != NULL)) features |= SHADER_FEATURE_NORMAL_MAP;
+		if (material.maps[MAP_SPECULAR].texture.id > 0) features |= SHADER_FEATURE_SPECULAR_MAP;
+	}
+	return features;
+}
+
+// Set uniform value on every variant, value is kept for variants compiled later
+// NOTE: Uniforms set on a single variant (or on material shader) don't reach other variants
+void SetShaderVariantsValue(ShaderVariants variants, const char *uniformName, const void *value, int uniformType, int count)
+{
+	if ((variants.programs == NULL) || (variants.uniforms == NULL)) return;
+	ShaderVariantsUniforms *uniforms = variants.uniforms;
+	int size = GetUniformTypeSize(uniformType)*count;
+	VariantUniform *uniform = NULL;
+	for (int i = 0; i < uniforms->count; i++)
+	{
+		if (strcmp(uniforms->values[i].name, uniformName) == 0)
+		{
+			uniform = &uniforms->values[i];
+			break;
+		}
+	}
+	if (uniform == NULL)
+	{
+		if (uniforms->count == uniforms->capacity)
+		{
+			int capacity = (uniforms->capacity > 0)? uniforms->capacity*2 : 8;
+			VariantUniform *values = (VariantUniform *)realloc(uniforms->values, capacity*sizeof(VariantUniform));
+			if (values == NULL)
+			{
+				debugNetPrintf(ERROR, "[ORBISGL] %s [%s] Variants uniform could not be allocated\n",__FUNCTION__, uniformName);
+				return;
+			}
+			uniforms->values = values;
+			uniforms->capacity = capacity;
+		}
+		// NOTE: Entry is only added once name and value are allocated
+		char *name = (char *)malloc(strlen(uniformName) + 1);
+		void *data = malloc(size);
+		if ((name == NULL) || (data == NULL))
+		{
+			debugNetPrintf(ERROR, "[ORBISGL] %s [%s] Variants uniform could not be allocated\n",__FUNCTION__, uniformName);
+			free(name);
+			free(data);
+			return;
+		}
+		strcpy(name, uniformName);
+		uniform = &uniforms->values[uniforms->count];
+		*uniform = (VariantUniform){ 0 };
+		uniform->name = name;
+		uniform->value = data;
+		uniforms->count++;
+	}
+	else if (GetUniformTypeSize(uniform->type)*uniform->count != size)
+	{
+		void *data = realloc(uniform->value, size);
+		if (data == NULL)
+		{
+			debugNetPrintf(ERROR, "[ORBISGL] %s [%s] Variants uniform could not be allocated\n",__FUNCTION__, uniformName);
+			return;
+		}
+		uniform->value = data;
+	}
+	memcpy(uniform->value, value, size);
+	uniform->type = uniformType;
+	uniform->count = count;
+	for (int i = 0; i < MAX_SHADER_VARIANTS; i++)
+	{
+		Shader shader = variants.programs[i];
+		if ((shader.id == 0) || (shader.id == RLGL.State.defaultShader.id)) continue;
+		int location = GetShaderLocation(shader, uniformName);
+		if (location != -1) SetShaderValueV(shader, location, value, uniformType, count);
+	}
+}
+
+// Unload shader variants code and compiled programs
+// NOTE: Variants set on materials are not unloaded by UnloadMaterial(), they could be shared
+void UnloadShaderVariants(ShaderVariants variants)
+{
+	if (variants.programs != NULL)
+	{
+		for (int i = 0; i < MAX_SHADER_VARIANTS; i++)
+		{
+			// NOTE: Variants failed to compile fall back to default shader, managed by rlgl
+			if ((variants.programs[i].id > 0) && (variants.programs[i].id != RLGL.State.defaultShader.id)) UnloadShader(variants.programs[i]);
+		}
+	}
+	if (variants.uniforms != NULL)
+	{
+		for (int i = 0; i < variants.uniforms->count; i++)
+		{
+			free(variants.uniforms->values[i].name);
+			free(variants.uniforms->values[i].value);
+		}
+		free(variants.uniforms->values);
+		free(variants.uniforms);
+	}
+	free(variants.programs);
+	free(variants.vsCode);
+	free(variants.fsCode);
+}
+
 // Begin custom shader mode
+// NOTE: Shader is registered per draw, changing it just starts a new draw (no batch flush),
+// uniform changes flush draws still pending with previous values
 void BeginShaderMode(Shader shader)
 {
+	if (threadBatch != NULL)
+	{
+		if (threadBatch->currentShader.id != shader.id)
+		{
+			threadBatch->currentShader = shader;
+			ThreadBatchNextDraw(threadBatch);
+		}
+		return;
+	}
 	if (RLGL.State.currentShader.id != shader.id)
 	{
-		rlglDraw();
 		RLGL.State.currentShader = shader;
+		rlNextDrawCall();
 	}
 }
 
@@ -1654,15 +2955,44 @@ void EndShaderMode(void)
 }
 
 // Get shader uniform location
+// NOTE: Locations are cached by program and name, GL is only queried once
 int GetShaderLocation(Shader shader, const char *uniformName)
 {
 	int location = -1;
+	if (FindUniformLocationCached(shader.id, uniformName, &location)) return location;
+	RenderThreadAcquireContext();
 	location = glGetUniformLocation(shader.id, uniformName);
 	if (location == -1) debugNetPrintf(ERROR, "[ORBISGL] %s [SHDR ID %i][%s] Shader uniform could not be found\n",__FUNCTION__, shader.id, uniformName);
 	else debugNetPrintf(INFO, "[ORBISGL] %s [SHDR ID %i][%s] Shader uniform set at location: %i\n",__FUNCTION__,shader.id, uniformName, location);
+	AddUniformLocationCached(shader.id, uniformName, location);
 	return location;
 }
 
+// Check if shader is used by any draw pending on default batch
+// NOTE: Thread batches are merged at a single point of the frame, they are drawn with uniform values set by then
+static bool ShaderHasPendingDraws(unsigned int shaderId)
+{
+	if (RLGL.State.vertexData[RLGL.State.currentBuffer].vCounter == 0) return false;
+	for (int i = 0; i < RLGL.State.drawsCounter; i++)
+	{
+		if ((RLGL.State.draws[i].shader.id == shaderId) && (RLGL.State.draws[i].vertexCount > 0)) return true;
+	}
+	return false;
+}
+
+// Flush pending draws of shader before one of its uniforms changes
+// NOTE: Shader changes don't flush batch, draws submitted before the uniform change must be drawn with previous value
+// NOTE: Game thread batch is never accessed from render thread
+static void FlushShaderDraws(unsigned int shaderId)
+{
+	if (renderThreadSelf || (threadBatch != NULL) || RLGL.State.listRecording) return;
+	if (ShaderHasPendingDraws(shaderId))
+	{
+		RLGL.State.flushCause = FLUSH_STATE_CHANGE;
+		rlglDraw();
+	}
+}
+
 // Set shader uniform value
 void SetShaderValue(Shader shader, int uniformLoc, const void *value, int uniformType)
 {
@@ -1672,20 +3002,22 @@ void SetShaderValue(Shader shader, int uniformLoc, const void *value, int unifor
 // Set shader uniform value vector
 void SetShaderValueV(Shader shader, int uniformLoc, const void *value, int uniformType, int count)
 {
-	glUseProgram(shader.id);
-	switch (uniformType)
+	FlushShaderDraws(shader.id);
+	if (RenderThreadRecording())
 	{
-		case UNIFORM_FLOAT: glUniform1fv(uniformLoc, count, (float *)value); break;
-		case UNIFORM_VEC2: glUniform2fv(uniformLoc, count, (float *)value); break;
-		case UNIFORM_VEC3: glUniform3fv(uniformLoc, count, (float *)value); break;
-		case UNIFORM_VEC4: glUniform4fv(uniformLoc, count, (float *)value); break;
-		case UNIFORM_INT: glUniform1iv(uniformLoc, count, (int *)value); break;
-		case UNIFORM_IVEC2: glUniform2iv(uniformLoc, count, (int *)value); break;
-		case UNIFORM_IVEC3: glUniform3iv(uniformLoc, count, (int *)value); break;
-		case UNIFORM_IVEC4: glUniform4iv(uniformLoc, count, (int *)value); break;
-		case UNIFORM_SAMPLER2D: glUniform1iv(uniformLoc, count, (int *)value); break;
-		default: debugNetPrintf(ERROR, "[ORBISGL] %s Shader uniform could not be set data type not recognized\n",__FUNCTION__);
+		RenderCommand *command = RenderThreadPush(RC_UNIFORM, value, GetUniformTypeSize(uniformType)*count);
+		if (command != NULL)
+		{
+			command->params[0] = shader.id;
+			command->params[1] = uniformLoc;
+			command->params[2] = uniformType;
+			command->params[3] = count;
+			return;
+		}
+		RenderThreadAcquireContext();   // Command could not be recorded, uniform is set synchronously
 	}
+	UseProgramCached(shader.id);
+	SetUniformCached(shader.id, uniformLoc, uniformType, value, count);     // Skipped if value already uploaded
 	//glUseProgram(0);      // Avoid reseting current shader program, in case other uniforms are set
 }
 
@@ -1693,16 +3025,35 @@ void SetShaderValueV(Shader shader, int uniformLoc, const void *value, int unifo
 // Set shader uniform value (matrix 4x4)
 void SetShaderValueMatrix(Shader shader, int uniformLoc, Matrix mat)
 {
-	glUseProgram(shader.id);
-	glUniformMatrix4fv(uniformLoc, 1, false, MatrixToFloat(mat));
+	FlushShaderDraws(shader.id);
+	if (RenderThreadRecording())
+	{
+		RenderCommand *command = RenderThreadPush(RC_UNIFORM_MATRIX, &mat, sizeof(Matrix));
+		if (command != NULL)
+		{
+			command->params[0] = shader.id;
+			command->params[1] = uniformLoc;
+			return;
+		}
+		RenderThreadAcquireContext();   // Command could not be recorded, uniform is set synchronously
+	}
+	UseProgramCached(shader.id);
+	SetUniformCached(shader.id, uniformLoc, UNIFORM_MATRIX, MatrixToFloatV(mat).v, 1);
 	//glUseProgram(0);
 }
 
 // Set shader uniform value for texture
 void SetShaderValueTexture(Shader shader, int uniformLoc, Texture2D texture)
 {
-	glUseProgram(shader.id);
-	glUniform1i(uniformLoc, texture.id);
+	FlushShaderDraws(shader.id);
+	if (RenderThreadRecording())
+	{
+		SetShaderValueV(shader, uniformLoc, &texture.id, UNIFORM_INT, 1);
+		return;
+	}
+	UseProgramCached(shader.id);
+	int id = texture.id;
+	SetUniformCached(shader.id, uniformLoc, UNIFORM_INT, &id, 1);
 	//glUseProgram(0);
 }
 
@@ -1710,6 +3061,8 @@ void SetShaderValueTexture(Shader shader, int uniformLoc, Texture2D texture)
 void SetMatrixProjection(Matrix projection)
 {
 	RLGL.State.projection = projection;
+	RLGL.State.viewProjectionDirty = true;
+	RLGL.State.meshViewProjectionDirty = true;
 }
 
 // Return internal projection matrix
@@ -1721,6 +3074,8 @@ Matrix GetMatrixProjection(void) {
 void SetMatrixModelview(Matrix view)
 {
     RLGL.State.modelview = view;
+    RLGL.State.viewProjectionDirty = true;
+    RLGL.State.meshViewProjectionDirty = true;
 }
 
 // Return internal modelview matrix
@@ -1735,11 +3090,12 @@ Matrix GetMatrixModelview(void)
 // TODO: OpenGL ES 2.0 does not support GL_RGB16F texture format, neither GL_DEPTH_COMPONENT24
 Texture2D GenTextureCubemap(Shader shader, Texture2D map, int size)
 {
+	RenderThreadAcquireContext();
 	Texture2D cubemap = { 0 };
 	// NOTE: SetShaderDefaultLocations() already setups locations for projection and view Matrix in shader
 	// Other locations should be setup externally in shader before calling the function
 	// Set up depth face culling and cubemap seamless
-	glDisable(GL_CULL_FACE);
+	SetCapabilityCached(GL_CULL_FACE, false);
 	// Setup framebuffer
 	unsigned int fbo, rbo;
 	glGenFramebuffers(1, &fbo);
@@ -1751,7 +3107,7 @@ Texture2D GenTextureCubemap(Shader shader, Texture2D map, int size)
 	// Set up cubemap to render and attach to framebuffer
 	// NOTE: Faces are stored as 32 bit floating point values
 	glGenTextures(1, &cubemap.id);
-	glBindTexture(GL_TEXTURE_CUBE_MAP, cubemap.id);
+	BindTextureCached(GL_TEXTURE_CUBE_MAP, cubemap.id);
 	for (unsigned int i = 0; i < 6; i++)
 	{
 		if (RLGL.ExtSupported.texFloat32) glTexImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_X + i, 0, GL_RGB, size, size, 0, GL_RGB, GL_FLOAT, NULL);
@@ -1771,9 +3127,9 @@ Texture2D GenTextureCubemap(Shader shader, Texture2D map, int size)
 		MatrixLookAt((Vector3){ 0.0f, 0.0f, 0.0f }, (Vector3){ 0.0f, 0.0f, -1.0f }, (Vector3){ 0.0f, -1.0f, 0.0f })
 	};
 	// Convert HDR equirectangular environment map to cubemap equivalent
-	glUseProgram(shader.id);
-	glActiveTexture(GL_TEXTURE0);
-	glBindTexture(GL_TEXTURE_2D, map.id);
+	UseProgramCached(shader.id);
+	ActiveTextureCached(0);
+	BindTextureCached(GL_TEXTURE_2D, map.id);
 	SetShaderValueMatrix(shader, shader.locs[LOC_MATRIX_PROJECTION], fboProjection);
 	// Note: don't forget to configure the viewport to the capture dimensions
 	glViewport(0, 0, size, size);
@@ -1802,6 +3158,7 @@ Texture2D GenTextureCubemap(Shader shader, Texture2D map, int size)
 // TODO: OpenGL ES 2.0 does not support GL_RGB16F texture format, neither GL_DEPTH_COMPONENT24
 Texture2D GenTextureIrradiance(Shader shader, Texture2D cubemap, int size)
 {
+	RenderThreadAcquireContext();
     Texture2D irradiance = { 0 };
 
 /*#if defined(GRAPHICS_API_OPENGL_33) // || defined(GRAPHICS_API_OPENGL_ES2)
@@ -1819,7 +3176,7 @@ Texture2D GenTextureIrradiance(Shader shader, Texture2D cubemap, int size)
 
     // Create an irradiance cubemap, and re-scale capture FBO to irradiance scale
     glGenTextures(1, &irradiance.id);
-    glBindTexture(GL_TEXTURE_CUBE_MAP, irradiance.id);
+    BindTextureCached(GL_TEXTURE_CUBE_MAP, irradiance.id);
     for (unsigned int i = 0; i < 6; i++)
     {
         glTexImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_X + i, 0, GL_RGB16F, size, size, 0, GL_RGB, GL_FLOAT, NULL);
@@ -1843,9 +3200,9 @@ Texture2D GenTextureIrradiance(Shader shader, Texture2D cubemap, int size)
     };
 
     // Solve diffuse integral by convolution to create an irradiance cubemap
-    glUseProgram(shader.id);
-    glActiveTexture(GL_TEXTURE0);
-    glBindTexture(GL_TEXTURE_CUBE_MAP, cubemap.id);
+    UseProgramCached(shader.id);
+    ActiveTextureCached(0);
+    BindTextureCached(GL_TEXTURE_CUBE_MAP, cubemap.id);
     SetShaderValueMatrix(shader, shader.locs[LOC_MATRIX_PROJECTION], fboProjection);
 
     // Note: don't forget to configure the viewport to the capture dimensions
@@ -1878,6 +3235,7 @@ Texture2D GenTextureIrradiance(Shader shader, Texture2D cubemap, int size)
 // TODO: OpenGL ES 2.0 does not support GL_RGB16F texture format, neither GL_DEPTH_COMPONENT24
 Texture2D GenTexturePrefilter(Shader shader, Texture2D cubemap, int size)
 {
+	RenderThreadAcquireContext();
     Texture2D prefilter = { 0 };
 
 /*#if defined(GRAPHICS_API_OPENGL_33) // || defined(GRAPHICS_API_OPENGL_ES2)
@@ -1897,7 +3255,7 @@ Texture2D GenTexturePrefilter(Shader shader, Texture2D cubemap, int size)
 
     // Create a prefiltered HDR environment map
     glGenTextures(1, &prefilter.id);
-    glBindTexture(GL_TEXTURE_CUBE_MAP, prefilter.id);
+    BindTextureCached(GL_TEXTURE_CUBE_MAP, prefilter.id);
     for (unsigned int i = 0; i < 6; i++)
     {
         glTexImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_X + i, 0, GL_RGB16F, size, size, 0, GL_RGB, GL_FLOAT, NULL);
@@ -1924,9 +3282,9 @@ Texture2D GenTexturePrefilter(Shader shader, Texture2D cubemap, int size)
     };
 
     // Prefilter HDR and store data into mipmap levels
-    glUseProgram(shader.id);
-    glActiveTexture(GL_TEXTURE0);
-    glBindTexture(GL_TEXTURE_CUBE_MAP, cubemap.id);
+    UseProgramCached(shader.id);
+    ActiveTextureCached(0);
+    BindTextureCached(GL_TEXTURE_CUBE_MAP, cubemap.id);
     SetShaderValueMatrix(shader, shader.locs[LOC_MATRIX_PROJECTION], fboProjection);
 
     glBindFramebuffer(GL_FRAMEBUFFER, fbo);
@@ -1944,7 +3302,7 @@ Texture2D GenTexturePrefilter(Shader shader, Texture2D cubemap, int size)
         glViewport(0, 0, mipWidth, mipHeight);
 
         float roughness = (float)mip/(float)(MAX_MIPMAP_LEVELS - 1);
-        glUniform1f(roughnessLoc, roughness);
+        SetUniformCached(shader.id, roughnessLoc, UNIFORM_FLOAT, &roughness, 1);
 
         for (int i = 0; i < 6; i++)
         {
@@ -1974,10 +3332,11 @@ Texture2D GenTexturePrefilter(Shader shader, Texture2D cubemap, int size)
 // TODO: Review implementation: https://github.com/HectorMF/BRDFGenerator
 Texture2D GenTextureBRDF(Shader shader, int size)
 {
+	RenderThreadAcquireContext();
 	Texture2D brdf = { 0 };
 	// Generate BRDF convolution texture
 	glGenTextures(1, &brdf.id);
-	glBindTexture(GL_TEXTURE_2D, brdf.id);
+	BindTextureCached(GL_TEXTURE_2D, brdf.id);
 	if (RLGL.ExtSupported.texFloat32) glTexImage2D(GL_TEXTURE_2D, 0, GL_RGB, size, size, 0, GL_RGB, GL_FLOAT, NULL);
 	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
 	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
@@ -1992,7 +3351,7 @@ Texture2D GenTextureBRDF(Shader shader, int size)
 	glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH_COMPONENT16, size, size);
 	glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, brdf.id, 0);
 	glViewport(0, 0, size, size);
-	glUseProgram(shader.id);
+	UseProgramCached(shader.id);
 	glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
 	GenDrawQuad();
 	// Unbind framebuffer and textures
@@ -2011,20 +3370,24 @@ Texture2D GenTextureBRDF(Shader shader, int size)
 
 // Begin blending mode (alpha, additive, multiplied)
 // NOTE: Only 3 blending modes supported, default blend mode is alpha
+// NOTE: Blending mode is registered per draw, changing it just starts a new draw (no batch flush),
+// GL blend function is also set right away for non batched drawing (rlDrawMesh())
 void BeginBlendMode(int mode)
 {
-	static int blendMode = 0;   // Track current blending mode
-	if ((blendMode != mode) && (mode < 3))
+	if (threadBatch != NULL)
 	{
-		rlglDraw();
-		switch (mode)
+		if ((threadBatch->currentBlendMode != mode) && (mode < 3))
 		{
-			case BLEND_ALPHA: glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA); break;
-			case BLEND_ADDITIVE: glBlendFunc(GL_SRC_ALPHA, GL_ONE); break; // Alternative: glBlendFunc(GL_ONE, GL_ONE);
-			case BLEND_MULTIPLIED: glBlendFunc(GL_DST_COLOR, GL_ONE_MINUS_SRC_ALPHA); break;
-			default: break;
+			threadBatch->currentBlendMode = mode;
+			ThreadBatchNextDraw(threadBatch);
 		}
-		blendMode = mode;
+		return;
+	}
+	if ((RLGL.State.currentBlendMode != mode) && (mode < 3))
+	{
+		RLGL.State.currentBlendMode = mode;
+		rlNextDrawCall();
+		SetBlendModeDefault(mode);
 	}
 }
 
@@ -2036,106 +3399,1231 @@ void EndBlendMode(void)
 
 
 //----------------------------------------------------------------------------------
-// Module specific Functions Definition
+// Module Functions Definition - Render thread
 //----------------------------------------------------------------------------------
 
-// Compile custom shader and return shader id
-unsigned int CompileShader(const char *shaderStr, int type)
+// Enable render thread mode: GL submission moves to a dedicated thread owning the EGL context
+// NOTE: Game thread records draws, uniforms and texture/buffer updates into a command list executed
+// by render thread after EndDrawing(), so next frame simulation overlaps current frame submission.
+// Other GL work (resources loading/unloading, readbacks) moves EGL context back to calling thread.
+void rlEnableRenderThread(void)
 {
-	unsigned int shader = glCreateShader(type);
-	glShaderSource(shader, 1, &shaderStr, NULL);
-	GLint success = 0;
-	glCompileShader(shader);
-	glGetShaderiv(shader, GL_COMPILE_STATUS, &success);
-	if (success != GL_TRUE)
+	if (renderThread.enabled) return;
+	rlglDraw();
+	for (int i = 0; i < 2; i++)
 	{
-		debugNetPrintf(ERROR, "[ORBISGL] %s [SHDR ID %i] Failed to compile shader...\n",__FUNCTION__,shader);
-		int maxLength = 0;
-		int length;
-		glGetShaderiv(shader, GL_INFO_LOG_LENGTH, &maxLength);
-		char log[maxLength];
-		glGetShaderInfoLog(shader, maxLength, &length, log);
-		debugNetPrintf(INFO, "[ORBISGL] %s %s\n",__FUNCTION__,log);
+		renderThread.lists[i].commands = (RenderCommand *)malloc(sizeof(RenderCommand)*RENDER_LIST_COMMANDS);
+		renderThread.lists[i].commandsCapacity = RENDER_LIST_COMMANDS;
+		renderThread.lists[i].commandsCount = 0;
+		renderThread.lists[i].data = (unsigned char *)malloc(RENDER_LIST_DATA);
+		renderThread.lists[i].dataCapacity = RENDER_LIST_DATA;
+		renderThread.lists[i].dataSize = 0;
 	}
-	else debugNetPrintf(INFO, "[ORBISGL] %s [SHDR ID %i] Shader compiled successfully\n",__FUNCTION__,shader);
-	return shader;
+	pthread_mutex_init(&renderThread.lock, NULL);
+	pthread_cond_init(&renderThread.cond, NULL);
+	renderThread.recording = 0;
+	renderThread.pending = NULL;
+	renderThread.contextRequest = false;
+	renderThread.gameContext = false;
+	renderThread.quit = false;
+	renderThread.renderBuffer = RLGL.State.currentBuffer;
+	orbisGlMakeCurrent(false);      // EGL context is made current by render thread
+	renderThread.enabled = true;
+	if (pthread_create(&renderThread.thread, NULL, RenderThreadMain, NULL) != 0)
+	{
+		debugNetPrintf(ERROR, "[ORBISGL] %s Render thread could not be created\n",__FUNCTION__);
+		renderThread.enabled = false;
+		orbisGlMakeCurrent(true);
+		UnloadRenderThread();
+		return;
+	}
+	debugNetPrintf(INFO, "[ORBISGL] %s Render thread started\n",__FUNCTION__);
 }
 
-// Load custom shader strings and return program id
-unsigned int LoadShaderProgram(unsigned int vShaderId, unsigned int fShaderId)
+// Disable render thread mode, recorded commands are executed and EGL context returns to calling thread
+void rlDisableRenderThread(void)
 {
-	unsigned int program = 0;
-	GLint success = 0;
-	program = glCreateProgram();
-	glAttachShader(program, vShaderId);
-	glAttachShader(program, fShaderId);
-	// NOTE: Default attribute shader locations must be binded before linking
-	glBindAttribLocation(program, 0, DEFAULT_ATTRIB_POSITION_NAME);
-	glBindAttribLocation(program, 1, DEFAULT_ATTRIB_TEXCOORD_NAME);
-	glBindAttribLocation(program, 2, DEFAULT_ATTRIB_NORMAL_NAME);
-	glBindAttribLocation(program, 3, DEFAULT_ATTRIB_COLOR_NAME);
-	glBindAttribLocation(program, 4, DEFAULT_ATTRIB_TANGENT_NAME);
-	glBindAttribLocation(program, 5, DEFAULT_ATTRIB_TEXCOORD2_NAME);
-	// NOTE: If some attrib name is no found on the shader, it locations becomes -1
-	glLinkProgram(program);
-	// NOTE: All uniform variables are intitialised to 0 when a program links
-	glGetProgramiv(program, GL_LINK_STATUS, &success);
-	if (success == GL_FALSE)
-	{
-		debugNetPrintf(ERROR, "[ORBISGL] %s [SHDR ID %i] Failed to link shader program...\n",__FUNCTION__,program);
-		int maxLength = 0;
-		int length;
-		glGetProgramiv(program, GL_INFO_LOG_LENGTH, &maxLength);
-		char log[maxLength];
-		glGetProgramInfoLog(program, maxLength, &length, log);
-		debugNetPrintf(INFO, "[ORBISGL] %s %s\n",__FUNCTION__, log);
-		glDeleteProgram(program);
-		program = 0;
-	}
-	else debugNetPrintf(INFO, "[ORBISGL] %s [SHDR ID %i] Shader program loaded successfully\n",__FUNCTION__,program);
-	return program;
+	if (!renderThread.enabled || renderThreadSelf) return;
+	RenderThreadAcquireContext();
+	pthread_mutex_lock(&renderThread.lock);
+	renderThread.quit = true;
+	pthread_cond_broadcast(&renderThread.cond);
+	pthread_mutex_unlock(&renderThread.lock);
+	pthread_join(renderThread.thread, NULL);
+	renderThread.enabled = false;
+	renderThread.gameContext = false;
+	UnloadRenderThread();
+	debugNetPrintf(INFO, "[ORBISGL] %s Render thread stopped\n",__FUNCTION__);
 }
 
+// Check if render thread mode is enabled
+bool rlIsRenderThreadEnabled(void)
+{
+	return renderThread.enabled;
+}
 
-// Load default shader (just vertex positioning and texture coloring)
-// NOTE: This shader program is used for internal buffers
-Shader LoadShaderDefault(void)
+// Check if GL work must be recorded for render thread instead of being executed
+bool RenderThreadRecording(void)
 {
-	Shader shader = { 0 };
-	shader.locs = (int *)calloc(MAX_SHADER_LOCATIONS, sizeof(int));
-	// NOTE: All locations must be reseted to -1 (no location)
-	for (int i = 0; i < MAX_SHADER_LOCATIONS; i++) shader.locs[i] = -1;
-	// Vertex shader directly defined, no external file required
-	const char *defaultVShaderStr =
-	"#version 100                       \n"
-	"attribute vec3 vertexPosition;     \n"
-	"attribute vec2 vertexTexCoord;     \n"
-	"attribute vec4 vertexColor;        \n"
-	"varying vec2 fragTexCoord;         \n"
-	"varying vec4 fragColor;            \n"
-	"uniform mat4 mvp;                  \n"
-	"void main()                        \n"
-	"{                                  \n"
-	"    fragTexCoord = vertexTexCoord; \n"
-	"    fragColor = vertexColor;       \n"
-	"    gl_Position = mvp*vec4(vertexPosition, 1.0); \n"
-	"}                                  \n";
-	// Fragment shader directly defined, no external file required
-	const char *defaultFShaderStr =
-	"#version 100                       \n"
-	"precision mediump float;           \n"     // precision required for OpenGL ES2 (WebGL)
-	"varying vec2 fragTexCoord;         \n"
-	"varying vec4 fragColor;            \n"
-	"uniform sampler2D texture0;        \n"
-	"uniform vec4 colDiffuse;           \n"
-	"void main()                        \n"
-	"{                                  \n"
-	"    vec4 texelColor = texture2D(texture0, fragTexCoord); \n" // NOTE: texture2D() is deprecated on OpenGL 3.3 and ES 3.0
-	"    gl_FragColor = texelColor*colDiffuse*fragColor;      \n"
-	"}                                  \n";
+	return (renderThread.enabled && !renderThreadSelf && !renderThread.gameContext);
+}
+
+// Record command on game thread list, payload is copied (data can be NULL to fill it later)
+static RenderCommand *RenderThreadPush(int type, const void *data, int dataSize)
+{
+	RenderCommandList *list = &renderThread.lists[renderThread.recording];
+	if (list->commandsCount >= list->commandsCapacity)
+	{
+		RenderCommand *commands = (RenderCommand *)realloc(list->commands, sizeof(RenderCommand)*list->commandsCapacity*2);
+		if (commands == NULL) return NULL;
+		list->commands = commands;
+		list->commandsCapacity *= 2;
+	}
+	int size = (dataSize + 15) & ~15;   // Keep payloads 16 bytes aligned
+	if ((list->dataSize + size) > list->dataCapacity)
+	{
+		int capacity = list->dataCapacity;
+		while ((list->dataSize + size) > capacity) capacity *= 2;
+		unsigned char *buffer = (unsigned char *)realloc(list->data, capacity);
+		if (buffer == NULL) return NULL;
+		list->data = buffer;
+		list->dataCapacity = capacity;
+	}
+	RenderCommand *command = &list->commands[list->commandsCount++];
+	memset(command, 0, sizeof(RenderCommand));
+	command->type = type;
+	command->dataOffset = list->dataSize;
+	command->dataSize = dataSize;
+	if ((data != NULL) && (dataSize > 0)) memcpy(list->data + list->dataSize, data, dataSize);
+	list->dataSize += size;
+	return command;
+}
+
+// Record command with integer parameters
+static void RenderThreadPushParams(int type, int p0, int p1, int p2, int p3)
+{
+	RenderCommand *command = RenderThreadPush(type, NULL, 0);
+	if (command == NULL) return;
+	command->params[0] = p0;
+	command->params[1] = p1;
+	command->params[2] = p2;
+	command->params[3] = p3;
+}
+
+// Get command payload on its list
+static unsigned char *RenderThreadData(RenderCommandList *list, RenderCommand *command)
+{
+	return list->data + command->dataOffset;
+}
+
+// Record current default buffer (MVP, draws and vertex data) and reset it
+void RenderThreadRecordBatch(void)
+{
+	DynamicBuffer *buffer = &RLGL.State.vertexData[RLGL.State.currentBuffer];
+	Matrix matMVP = GetViewProjection();
+	int drawsSize = sizeof(DrawCall)*RLGL.State.drawsCounter;
+	int verticesSize = sizeof(BatchVertex)*buffer->vCounter;
+	RenderCommand *command = RenderThreadPush(RC_BATCH, NULL, sizeof(Matrix) + drawsSize + verticesSize);
+	if (command != NULL)
+	{
+		unsigned char *data = RenderThreadData(&renderThread.lists[renderThread.recording], command);
+		memcpy(data, &matMVP, sizeof(Matrix));
+		memcpy(data + sizeof(Matrix), RLGL.State.draws, drawsSize);
+		memcpy(data + sizeof(Matrix) + drawsSize, buffer->vertices, verticesSize);
+		command->params[0] = buffer->vCounter;
+		command->params[1] = RLGL.State.drawsCounter;
+		command->params[2] = RLGL.State.currentBlendMode;
+		command->params[3] = RLGL.State.indexType;
+		// Stats are counted here, render thread does not touch them
+		RLGL.State.frameStats.bytesUploaded += verticesSize;
+		for (int i = 0; i < RLGL.State.drawsCounter; i++) if (RLGL.State.draws[i].vertexCount > 0) RLGL.State.frameStats.drawCalls++;
+	}
+	else debugNetPrintf(ERROR, "[ORBISGL] %s Render command could not be allocated, batch dropped\n",__FUNCTION__);
+	ResetBuffersDefault();
+}
+
+// Record mesh draw, material maps and shader locations are copied
+void RenderThreadRecordMesh(Mesh mesh, Material material, Matrix matModel, Matrix matView, Matrix matProjection, Matrix matMVP)
+{
+	// NOTE: Bone matrices are copied after the command, mesh ones could be updated before execution
+	int bonesSize = (mesh.boneMatrices != NULL)? mesh.boneCount*3*4*sizeof(float) : 0;
+	RenderCommand *command = RenderThreadPush(RC_MESH, NULL, sizeof(MeshCommand) + bonesSize);
+	if (command == NULL)
+	{
+		// Command could not be recorded, mesh is drawn synchronously
+		RenderThreadAcquireContext();
+		DrawMeshDefault(mesh, material, matModel, matView, matProjection, matMVP);
+		return;
+	}
+	MeshCommand *meshCommand = (MeshCommand *)RenderThreadData(&renderThread.lists[renderThread.recording], command);
+	meshCommand->mesh = mesh;
+	meshCommand->material = material;
+	if (material.maps != NULL) memcpy(meshCommand->maps, material.maps, sizeof(meshCommand->maps));
+	if (material.shader.locs != NULL) memcpy(meshCommand->locs, material.shader.locs, sizeof(meshCommand->locs));
+	meshCommand->matModel = matModel;
+	meshCommand->matView = matView;
+	meshCommand->matProjection = matProjection;
+	meshCommand->matMVP = matMVP;
+	if (bonesSize > 0) memcpy(meshCommand + 1, mesh.boneMatrices, bonesSize);
+}
+
+// Record display list draw, list draws are copied
+void RenderThreadRecordList(DisplayList list, Matrix matMVP)
+{
+	int drawsSize = sizeof(DrawCall)*list.drawsCount;
+	RenderCommand *command = RenderThreadPush(RC_LIST, NULL, sizeof(Matrix) + drawsSize);
+	if (command == NULL)
+	{
+		// Command could not be recorded, list is drawn synchronously
+		RenderThreadAcquireContext();
+		DrawListDefault(list.vaoId, list.vboId, list.draws, list.drawsCount, matMVP, RLGL.State.currentBlendMode);
+		return;
+	}
+	unsigned char *data = RenderThreadData(&renderThread.lists[renderThread.recording], command);
+	memcpy(data, &matMVP, sizeof(Matrix));
+	memcpy(data + sizeof(Matrix), list.draws, drawsSize);
+	command->params[0] = list.vaoId;
+	command->params[1] = list.vboId;
+	command->params[2] = list.drawsCount;
+	command->params[3] = RLGL.State.currentBlendMode;
+}
+
+// Record frame end (buffers swap) and submit recorded frame to render thread
+// NOTE: It waits only for previous frame to be executed
+void RenderThreadSubmitFrame(void)
+{
+	RenderThreadPushParams(RC_SWAP, 0, 0, 0, 0);
+	RenderThreadSubmit();
+}
+
+// Submit recorded commands to render thread
+static void RenderThreadSubmit(void)
+{
+	RenderCommandList *list = &renderThread.lists[renderThread.recording];
+	if (list->commandsCount == 0) return;
+	pthread_mutex_lock(&renderThread.lock);
+	if (renderThread.gameContext)
+	{
+		// Render thread makes EGL context current again to execute the list
+		orbisGlMakeCurrent(false);
+		renderThread.gameContext = false;
+	}
+	while (renderThread.pending != NULL) pthread_cond_wait(&renderThread.cond, &renderThread.lock);
+	renderThread.lastCacheStats = renderThread.cacheStats;      // Stats of a previous frame, lagging one frame behind
+	renderThread.pending = list;
+	renderThread.recording = (renderThread.recording + 1)%2;
+	pthread_cond_broadcast(&renderThread.cond);
+	pthread_mutex_unlock(&renderThread.lock);
+	// Other list was already executed, it's reused for recording
+	renderThread.lists[renderThread.recording].commandsCount = 0;
+	renderThread.lists[renderThread.recording].dataSize = 0;
+}
+
+// Make EGL context current on game thread for immediate GL work
+// NOTE: Commands recorded so far are executed first to keep GL calls order, context stays on
+// game thread (no recording) until next frame is submitted
+void RenderThreadAcquireContext(void)
+{
+	if (!renderThread.enabled || renderThreadSelf || renderThread.gameContext) return;
+	rlglDraw();
+	RenderThreadSubmit();
+	pthread_mutex_lock(&renderThread.lock);
+	while (renderThread.pending != NULL) pthread_cond_wait(&renderThread.cond, &renderThread.lock);
+	renderThread.contextRequest = true;
+	pthread_cond_broadcast(&renderThread.cond);
+	while (!renderThread.gameContext) pthread_cond_wait(&renderThread.cond, &renderThread.lock);
+	pthread_mutex_unlock(&renderThread.lock);
+	orbisGlMakeCurrent(true);
+}
+
+// Execute recorded commands list (render thread)
+static void RenderThreadExecute(RenderCommandList *list)
+{
+	BeginProfileScope("RenderThreadExecute");
+	for (int i = 0; i < list->commandsCount; i++)
+	{
+		RenderCommand *command = &list->commands[i];
+		unsigned char *data = RenderThreadData(list, command);
+		switch (command->type)
+		{
+			case RC_BATCH:
+			{
+				DynamicBuffer *buffer = &RLGL.State.vertexData[renderThread.renderBuffer];
+				renderThread.renderBuffer = (renderThread.renderBuffer + 1)%MAX_BATCH_BUFFERING;
+				Matrix matMVP;
+				memcpy(&matMVP, data, sizeof(Matrix));
+				DrawCall *draws = (DrawCall *)(data + sizeof(Matrix));
+				BatchVertex *vertices = (BatchVertex *)(data + sizeof(Matrix) + sizeof(DrawCall)*command->params[1]);
+				UploadBatchDefault(buffer, vertices, command->params[0]);
+				DrawBatchDefault(buffer, draws, command->params[1], matMVP, command->params[2], command->params[3]);
+			} break;
+			case RC_MESH:
+			{
+				MeshCommand *meshCommand = (MeshCommand *)data;
+				meshCommand->material.maps = meshCommand->maps;
+				meshCommand->material.shader.locs = meshCommand->locs;
+				if (meshCommand->mesh.boneMatrices != NULL) meshCommand->mesh.boneMatrices = (float *)(meshCommand + 1);
+				DrawMeshDefault(meshCommand->mesh, meshCommand->material, meshCommand->matModel, meshCommand->matView, meshCommand->matProjection, meshCommand->matMVP);
+			} break;
+			case RC_LIST:
+			{
+				Matrix matMVP;
+				memcpy(&matMVP, data, sizeof(Matrix));
+				DrawListDefault(command->params[0], command->params[1], (DrawCall *)(data + sizeof(Matrix)), command->params[2], matMVP, command->params[3]);
+			} break;
+			case RC_UNIFORM:
+			{
+				// NOTE: Public SetShaderValue*() functions access game thread batch, not called here
+				UseProgramCached(command->params[0]);
+				SetUniformCached(command->params[0], command->params[1], command->params[2], data, command->params[3]);
+			} break;
+			case RC_UNIFORM_MATRIX:
+			{
+				Matrix mat;
+				memcpy(&mat, data, sizeof(Matrix));
+				UseProgramCached(command->params[0]);
+				SetUniformCached(command->params[0], command->params[1], UNIFORM_MATRIX, MatrixToFloatV(mat).v, 1);
+			} break;
+			case RC_TEXTURE_UPDATE: rlUpdateTextureRec(command->params[0], command->params[1], command->params[2], command->params[3], command->params[4], command->params[5], data); break;
+			case RC_BUFFER_UPDATE:
+			{
+				BindBufferCached(GL_ARRAY_BUFFER, command->params[0]);
+				glBufferSubData(GL_ARRAY_BUFFER, 0, command->dataSize, data);
+			} break;
+			case RC_CLEAR_COLOR: rlClearColor(command->params[0], command->params[1], command->params[2], command->params[3]); break;
+			case RC_CLEAR: rlClearScreenBuffers(); break;
+			case RC_VIEWPORT: rlViewport(command->params[0], command->params[1], command->params[2], command->params[3]); break;
+			case RC_SCISSOR: rlScissor(command->params[0], command->params[1], command->params[2], command->params[3]); break;
+			case RC_FRAMEBUFFER: rlEnableRenderTexture(command->params[0]); break;
+			case RC_CAPABILITY: SetCapabilityCached(command->params[0], command->params[1]); break;
+			case RC_BLEND_MODE: SetBlendModeDefault(command->params[0]); break;
+			case RC_SWAP:
+			{
+				EndFrameCached();
+				orbisGlSwapBuffers();
+			} break;
+			default: break;
+		}
+	}
+	EndProfileScope();
+}
+
+// Render thread main loop: execute submitted lists, give EGL context away when requested
+static void *RenderThreadMain(void *arg)
+{
+	bool context = false;
+	renderThreadSelf = true;
+	pthread_mutex_lock(&renderThread.lock);
+	while (true)
+	{
+		if (renderThread.pending != NULL)
+		{
+			RenderCommandList *list = renderThread.pending;
+			pthread_mutex_unlock(&renderThread.lock);
+			if (!context)
+			{
+				orbisGlMakeCurrent(true);
+				context = true;
+			}
+			RenderThreadExecute(list);
+			pthread_mutex_lock(&renderThread.lock);
+			GetFrameStatsCached(&renderThread.cacheStats);
+			renderThread.pending = NULL;
+			pthread_cond_broadcast(&renderThread.cond);
+		}
+		else if (renderThread.contextRequest)
+		{
+			if (context)
+			{
+				orbisGlMakeCurrent(false);
+				context = false;
+			}
+			renderThread.contextRequest = false;
+			renderThread.gameContext = true;
+			pthread_cond_broadcast(&renderThread.cond);
+		}
+		else if (renderThread.quit) break;
+		else pthread_cond_wait(&renderThread.cond, &renderThread.lock);
+	}
+	pthread_mutex_unlock(&renderThread.lock);
+	if (context) orbisGlMakeCurrent(false);
+	return NULL;
+}
+
+// Unload render thread command lists and synchronization objects
+static void UnloadRenderThread(void)
+{
+	for (int i = 0; i < 2; i++)
+	{
+		free(renderThread.lists[i].commands);
+		free(renderThread.lists[i].data);
+		memset(&renderThread.lists[i], 0, sizeof(RenderCommandList));
+	}
+	pthread_cond_destroy(&renderThread.cond);
+	pthread_mutex_destroy(&renderThread.lock);
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition - Thread batches
+//----------------------------------------------------------------------------------
+
+// Begin recording rl* vertex submissions of calling thread into a thread batch
+// NOTE: Worker threads can build vertex data (shapes, text, textures drawing) in parallel, ended
+// batches are merged into default batch by EndDrawing() or rlMergeThreadBatches(), lower keys first.
+// Matrix stack and shader/blend modes are per batch, GL calls and resources loading are not allowed.
+void rlBeginThreadBatch(int key)
+{
+	if (threadBatch != NULL)
+	{
+		debugNetPrintf(ERROR, "[ORBISGL] %s Thread batch already recording on this thread\n",__FUNCTION__);
+		return;
+	}
+	pthread_mutex_lock(&threadBatches.lock);
+	ThreadBatch *batch = threadBatches.unused;
+	if (batch != NULL) threadBatches.unused = batch->next;
+	pthread_mutex_unlock(&threadBatches.lock);
+	if (batch == NULL)
+	{
+		batch = (ThreadBatch *)calloc(1, sizeof(ThreadBatch));
+		if (batch != NULL)
+		{
+			batch->buffer.vertices = (BatchVertex *)malloc(sizeof(BatchVertex)*THREAD_BATCH_VERTICES);
+			batch->capacity = THREAD_BATCH_VERTICES;
+			batch->draws = (DrawCall *)malloc(sizeof(DrawCall)*THREAD_BATCH_DRAWS);
+			batch->drawsCapacity = THREAD_BATCH_DRAWS;
+		}
+		if ((batch == NULL) || (batch->buffer.vertices == NULL) || (batch->draws == NULL))
+		{
+			debugNetPrintf(ERROR, "[ORBISGL] %s Thread batch could not be allocated\n",__FUNCTION__);
+			if (batch != NULL)
+			{
+				free(batch->buffer.vertices);
+				free(batch->draws);
+				free(batch);
+			}
+			return;
+		}
+	}
+	batch->key = key;
+	batch->buffer.vCounter = 0;
+	batch->buffer.tcCounter = 0;
+	batch->buffer.cCounter = 0;
+	batch->currentShader = RLGL.State.defaultShader;
+	batch->currentBlendMode = BLEND_ALPHA;
+	batch->currentDepth = -1.0f;
+	batch->transform = MatrixIdentity();
+	batch->stackCounter = 0;
+	batch->doTransform = false;
+	batch->next = NULL;
+	batch->drawsCounter = 1;
+	memset(&batch->draws[0], 0, sizeof(DrawCall));
+	batch->draws[0].mode = RL_QUADS;
+	batch->draws[0].textureId = RLGL.State.defaultTextureId;
+	batch->draws[0].shader = batch->currentShader;
+	batch->draws[0].blendMode = batch->currentBlendMode;
+	threadBatch = batch;
+}
+
+// End thread batch recording, it's merged into default batch on next rlglDraw()
+void rlEndThreadBatch(void)
+{
+	ThreadBatch *batch = threadBatch;
+	if (batch == NULL) return;
+	threadBatch = NULL;
+	pthread_mutex_lock(&threadBatches.lock);
+	if (batch->buffer.vCounter > 0)
+	{
+		batch->sequence = threadBatches.sequence++;
+		batch->next = threadBatches.ready;
+		threadBatches.ready = batch;
+	}
+	else
+	{
+		batch->next = threadBatches.unused;
+		threadBatches.unused = batch;
+	}
+	pthread_mutex_unlock(&threadBatches.lock);
+}
+
+// Enable GPU skinning, UpdateModelAnimation() only sets mesh bone matrices (meshes with up to MAX_SKINNING_BONES bones)
+void rlEnableGpuSkinning(void)
+{
+	RLGL.State.gpuSkinning = true;
+}
+
+// Disable GPU skinning, animated meshes vertex are skinned on CPU and uploaded by UpdateModelAnimation()
+void rlDisableGpuSkinning(void)
+{
+	RLGL.State.gpuSkinning = false;
+}
+
+// Check if GPU skinning is enabled
+bool rlIsGpuSkinningEnabled(void)
+{
+	return RLGL.State.gpuSkinning;
+}
+
+// Get depth for next 2d vertex of calling thread (thread batch or default batch)
+float GetBatchDepth(void)
+{
+	return (threadBatch != NULL)? threadBatch->currentDepth : RLGL.State.currentDepth;
+}
+
+// Close current draw (if it has vertex), following vertex go to a new draw with same mode and texture
+static void ThreadBatchNextDraw(ThreadBatch *batch)
+{
+	if (batch->draws[batch->drawsCounter - 1].vertexCount > 0)
+	{
+		if (batch->drawsCounter >= batch->drawsCapacity)
+		{
+			DrawCall *draws = (DrawCall *)realloc(batch->draws, sizeof(DrawCall)*batch->drawsCapacity*2);
+			if (draws == NULL)
+			{
+				debugNetPrintf(ERROR, "[ORBISGL] %s Thread batch draws could not be grown\n",__FUNCTION__);
+				return;
+			}
+			batch->draws = draws;
+			batch->drawsCapacity *= 2;
+		}
+		batch->draws[batch->drawsCounter] = batch->draws[batch->drawsCounter - 1];
+		batch->draws[batch->drawsCounter].vertexCount = 0;
+		batch->drawsCounter++;
+	}
+	batch->draws[batch->drawsCounter - 1].shader = batch->currentShader;
+	batch->draws[batch->drawsCounter - 1].blendMode = batch->currentBlendMode;
+}
+
+// Make room for count more vertex/texcoords/colors
+static bool ThreadBatchGrow(ThreadBatch *batch, int count)
+{
+	DynamicBuffer *buffer = &batch->buffer;
+	int required = buffer->vCounter;
+	if (buffer->tcCounter > required) required = buffer->tcCounter;
+	if (buffer->cCounter > required) required = buffer->cCounter;
+	required += count;
+	if (required <= batch->capacity) return true;
+	int capacity = batch->capacity;
+	while (capacity < required) capacity *= 2;
+	BatchVertex *vertices = (BatchVertex *)realloc(buffer->vertices, sizeof(BatchVertex)*capacity);
+	if (vertices == NULL)
+	{
+		debugNetPrintf(ERROR, "[ORBISGL] %s Thread batch could not be grown, vertex dropped\n",__FUNCTION__);
+		return false;
+	}
+	buffer->vertices = vertices;
+	batch->capacity = capacity;
+	return true;
+}
+
+// Reserve room for count vertex after last vertex defined
+// NOTE: Texcoords/colors lagging behind vertex are filled as rlEnd() does
+static BatchVertex *ThreadBatchReserve(ThreadBatch *batch, int count)
+{
+	DynamicBuffer *buffer = &batch->buffer;
+	if (!ThreadBatchGrow(batch, count)) return NULL;
+	for (; buffer->tcCounter < buffer->vCounter; buffer->tcCounter++)
+	{
+		buffer->vertices[buffer->tcCounter].texcoord[0] = 0.0f;
+		buffer->vertices[buffer->tcCounter].texcoord[1] = 0.0f;
+	}
+	for (; (buffer->cCounter > 0) && (buffer->cCounter < buffer->vCounter); buffer->cCounter++) memcpy(buffer->vertices[buffer->cCounter].color, buffer->vertices[buffer->cCounter - 1].color, 4);
+	return &buffer->vertices[buffer->vCounter];
+}
+
+// Commit count vertex written on reserved room to current draw, transform is applied right away
+static void ThreadBatchCommit(ThreadBatch *batch, int count)
+{
+	DynamicBuffer *buffer = &batch->buffer;
+	if (batch->doTransform)
+	{
+		for (int i = buffer->vCounter; i < buffer->vCounter + count; i++)
+		{
+			Vector3 position = { buffer->vertices[i].position[0], buffer->vertices[i].position[1], buffer->vertices[i].position[2] };
+			position = Vector3Transform(position, batch->transform);
+			memcpy(buffer->vertices[i].position, &position, sizeof(float)*3);
+		}
+	}
+	buffer->vCounter += count;
+	buffer->tcCounter = buffer->vCounter;
+	buffer->cCounter = buffer->vCounter;
+	batch->draws[batch->drawsCounter - 1].vertexCount += count;
+}
+
+// Finish vertex providing, texcoords/colors count must match vertex count
+static void ThreadBatchEnd(ThreadBatch *batch)
+{
+	DynamicBuffer *buffer = &batch->buffer;
+	for (; buffer->cCounter < buffer->vCounter; buffer->cCounter++)
+	{
+		if (buffer->cCounter > 0) memcpy(buffer->vertices[buffer->cCounter].color, buffer->vertices[buffer->cCounter - 1].color, 4);
+		else memset(buffer->vertices[buffer->cCounter].color, 255, 4);
+	}
+	for (; buffer->tcCounter < buffer->vCounter; buffer->tcCounter++)
+	{
+		buffer->vertices[buffer->tcCounter].texcoord[0] = 0.0f;
+		buffer->vertices[buffer->tcCounter].texcoord[1] = 0.0f;
+	}
+	batch->currentDepth += (1.0f/20000.0f);
+}
+
+// Compare thread batches merge order (key, then submission order)
+static int CompareThreadBatches(const void *a, const void *b)
+{
+	const ThreadBatch *batchA = *(const ThreadBatch **)a;
+	const ThreadBatch *batchB = *(const ThreadBatch **)b;
+	if (batchA->key != batchB->key) return (batchA->key < batchB->key)? -1 : 1;
+	if (batchA->sequence != batchB->sequence) return (batchA->sequence < batchB->sequence)? -1 : 1;
+	return 0;
+}
+
+// Merge ended thread batches into default batch, after vertex already submitted
+// NOTE: Batches vertex are already transformed, default batch flushes as usual if full
+static void MergeThreadBatches(void)
+{
+	pthread_mutex_lock(&threadBatches.lock);
+	ThreadBatch *ready = threadBatches.ready;
+	threadBatches.ready = NULL;
+	pthread_mutex_unlock(&threadBatches.lock);
+	if (ready == NULL) return;
+	BeginProfileScope("MergeThreadBatches");
+	int count = 0;
+	for (ThreadBatch *batch = ready; batch != NULL; batch = batch->next) count++;
+	ThreadBatch **batches = (ThreadBatch **)malloc(sizeof(ThreadBatch *)*count);
+	if (batches != NULL)
+	{
+		count = 0;
+		for (ThreadBatch *batch = ready; batch != NULL; batch = batch->next) batches[count++] = batch;
+		qsort(batches, count, sizeof(ThreadBatch *), CompareThreadBatches);
+		Shader shader = RLGL.State.currentShader;
+		int blendMode = RLGL.State.currentBlendMode;
+		bool doTransform = RLGL.State.doTransform;
+		RLGL.State.doTransform = false;
+		RLGL.State.transformDirty = true;
+		for (int i = 0; i < count; i++)
+		{
+			int vertexOffset = 0;
+			for (int j = 0; j < batches[i]->drawsCounter; j++)
+			{
+				DrawCall *draw = &batches[i]->draws[j];
+				if (draw->vertexCount == 0) continue;
+				if ((RLGL.State.currentShader.id != draw->shader.id) || (RLGL.State.currentBlendMode != draw->blendMode))
+				{
+					RLGL.State.currentShader = draw->shader;
+					RLGL.State.currentBlendMode = draw->blendMode;
+					rlNextDrawCall();
+				}
+				rlBegin(draw->mode);
+				rlEnableTexture(draw->textureId);
+				RLGL.State.draws[RLGL.State.drawsCounter - 1].mode = draw->mode;
+				int k = 0;
+				while (k < draw->vertexCount)
+				{
+					int chunk = rlReserveVertex(draw->vertexCount - k);
+					memcpy(&RLGL.State.vertexData[RLGL.State.currentBuffer].vertices[RLGL.State.vertexData[RLGL.State.currentBuffer].vCounter], &batches[i]->buffer.vertices[vertexOffset + k], sizeof(BatchVertex)*chunk);
+					rlCommitVertex(chunk);
+					k += chunk;
+				}
+				rlEnd();
+				vertexOffset += draw->vertexCount;
+			}
+		}
+		if ((RLGL.State.currentShader.id != shader.id) || (RLGL.State.currentBlendMode != blendMode))
+		{
+			RLGL.State.currentShader = shader;
+			RLGL.State.currentBlendMode = blendMode;
+			rlNextDrawCall();
+		}
+		RLGL.State.doTransform = doTransform;
+		RLGL.State.transformDirty = true;
+		free(batches);
+	}
+	else debugNetPrintf(ERROR, "[ORBISGL] %s Thread batches could not be sorted, dropped\n",__FUNCTION__);
+	// Merged batches are kept for reuse
+	pthread_mutex_lock(&threadBatches.lock);
+	while (ready != NULL)
+	{
+		ThreadBatch *next = ready->next;
+		ready->next = threadBatches.unused;
+		threadBatches.unused = ready;
+		ready = next;
+	}
+	pthread_mutex_unlock(&threadBatches.lock);
+	EndProfileScope();
+}
+
+// Merge thread batches ended so far into default batch, at current point of the frame
+// NOTE: Only merge point besides EndDrawing(), batches are never merged by other flushes (render texture,
+// shader or list changes) so their place in the frame doesn't depend on workers timing
+void rlMergeThreadBatches(void)
+{
+	if ((threadBatch != NULL) || RLGL.State.listRecording) return;     // Not merged into display lists
+	MergeThreadBatches();
+}
+
+// Unload thread batches memory (batches still recording are lost)
+static void UnloadThreadBatches(void)
+{
+	pthread_mutex_lock(&threadBatches.lock);
+	ThreadBatch *lists[2] = { threadBatches.ready, threadBatches.unused };
+	threadBatches.ready = NULL;
+	threadBatches.unused = NULL;
+	pthread_mutex_unlock(&threadBatches.lock);
+	for (int i = 0; i < 2; i++)
+	{
+		while (lists[i] != NULL)
+		{
+			ThreadBatch *next = lists[i]->next;
+			free(lists[i]->buffer.vertices);
+			free(lists[i]->draws);
+			free(lists[i]);
+			lists[i] = next;
+		}
+	}
+}
+
+//----------------------------------------------------------------------------------
+// Module specific Functions Definition
+//----------------------------------------------------------------------------------
+
+// Use shader program (skipped if already in use)
+void UseProgramCached(unsigned int id)
+{
+	if (RLGL.Cache.program == id) { RLGL.Cache.elidedCalls++; return; }
+	glUseProgram(id);
+	RLGL.Cache.program = id;
+}
+
+// Set active texture unit (skipped if already active)
+void ActiveTextureCached(unsigned int unit)
+{
+	if (RLGL.Cache.activeUnit == unit) { RLGL.Cache.elidedCalls++; return; }
+	glActiveTexture(GL_TEXTURE0 + unit);
+	RLGL.Cache.activeUnit = unit;
+}
+
+// Bind texture on active texture unit (skipped if already bound)
+// NOTE: Only GL_TEXTURE_2D and GL_TEXTURE_CUBE_MAP on first MAX_MATERIAL_MAPS units are tracked
+void BindTextureCached(unsigned int target, unsigned int id)
+{
+	unsigned int *bound = NULL;
+	if (RLGL.Cache.activeUnit < MAX_MATERIAL_MAPS)
+	{
+		if (target == GL_TEXTURE_2D) bound = &RLGL.Cache.texture2D[RLGL.Cache.activeUnit];
+		else if (target == GL_TEXTURE_CUBE_MAP) bound = &RLGL.Cache.textureCube[RLGL.Cache.activeUnit];
+	}
+	if ((bound != NULL) && (*bound == id)) { RLGL.Cache.elidedCalls++; return; }
+	glBindTexture(target, id);
+	RLGL.Cache.textureBinds++;
+	if (bound != NULL) *bound = id;
+}
+
+// Bind buffer (skipped if already bound)
+void BindBufferCached(unsigned int target, unsigned int id)
+{
+	unsigned int *bound = NULL;
+	if (target == GL_ARRAY_BUFFER) bound = &RLGL.Cache.arrayBuffer;
+	else if (target == GL_ELEMENT_ARRAY_BUFFER) bound = &RLGL.Cache.elementBuffer;
+	if ((bound != NULL) && (*bound == id)) { RLGL.Cache.elidedCalls++; return; }
+	glBindBuffer(target, id);
+	if (bound != NULL) *bound = id;
+}
+
+// Bind vertex array object (skipped if already bound)
+void BindVertexArrayCached(unsigned int id)
+{
+	if (RLGL.Cache.vao == id) { RLGL.Cache.elidedCalls++; return; }
+	glBindVertexArray(id);
+	RLGL.Cache.vao = id;
+	RLGL.Cache.elementBuffer = RL_STATE_UNKNOWN;   // Element buffer binding belongs to VAO state
+}
+
+// Set blend function (skipped if factors already set)
+void BlendFuncCached(unsigned int src, unsigned int dst)
+{
+	if ((RLGL.Cache.blendSrc == src) && (RLGL.Cache.blendDst == dst)) { RLGL.Cache.elidedCalls++; return; }
+	glBlendFunc(src, dst);
+	RLGL.Cache.blendSrc = src;
+	RLGL.Cache.blendDst = dst;
+}
+
+// Enable/disable GL capability (skipped if already in that state)
+// NOTE: Only GL_DEPTH_TEST, GL_CULL_FACE and GL_SCISSOR_TEST are tracked
+void SetCapabilityCached(unsigned int cap, bool enabled)
+{
+	if (RenderThreadRecording())
+	{
+		RenderThreadPushParams(RC_CAPABILITY, cap, enabled, 0, 0);
+		return;
+	}
+	int *state = NULL;
+	if (cap == GL_DEPTH_TEST) state = &RLGL.Cache.depthTest;
+	else if (cap == GL_CULL_FACE) state = &RLGL.Cache.cullFace;
+	else if (cap == GL_SCISSOR_TEST) state = &RLGL.Cache.scissorTest;
+	if ((state != NULL) && (*state == (int)enabled)) { RLGL.Cache.elidedCalls++; return; }
+	if (enabled) glEnable(cap);
+	else glDisable(cap);
+	if (state != NULL) *state = (int)enabled;
+}
+
+// Drop a deleted object from the state cache
+// NOTE: GL resets bindings of deleted objects to 0, ids can be reused by following objects
+void ForgetObjectCached(unsigned int target, unsigned int id)
+{
+	switch (target)
+	{
+		case GL_TEXTURE_2D:
+		{
+			for (int i = 0; i < MAX_MATERIAL_MAPS; i++)
+			{
+				if (RLGL.Cache.texture2D[i] == id) RLGL.Cache.texture2D[i] = 0;
+				if (RLGL.Cache.textureCube[i] == id) RLGL.Cache.textureCube[i] = 0;
+			}
+		} break;
+		case GL_ARRAY_BUFFER:
+		{
+			if (RLGL.Cache.arrayBuffer == id) RLGL.Cache.arrayBuffer = 0;
+			if (RLGL.Cache.elementBuffer == id) RLGL.Cache.elementBuffer = 0;
+		} break;
+		case GL_VERTEX_ARRAY_BINDING_OES:
+		{
+			if (RLGL.Cache.vao == id)
+			{
+				RLGL.Cache.vao = 0;
+				RLGL.Cache.elementBuffer = RL_STATE_UNKNOWN;
+			}
+		} break;
+		case GL_CURRENT_PROGRAM:
+		{
+			// NOTE: Program in use is only flagged for deletion, binding remains
+			if (RLGL.Cache.program == id) RLGL.Cache.program = RL_STATE_UNKNOWN;
+			ForgetUniformsCached(id);
+		} break;
+		default: break;
+	}
+}
+
+// Get size of one uniform element of a type
+static int GetUniformTypeSize(int uniformType)
+{
+	switch (uniformType)
+	{
+		case UNIFORM_VEC2: case UNIFORM_IVEC2: return 2*sizeof(int);
+		case UNIFORM_VEC3: case UNIFORM_IVEC3: return 3*sizeof(int);
+		case UNIFORM_VEC4: case UNIFORM_IVEC4: return 4*sizeof(int);
+		case UNIFORM_MATRIX: return 16*sizeof(float);
+		default: return sizeof(int);
+	}
+}
+
+// Hash uniform name (FNV-1a)
+static unsigned int HashUniformName(unsigned int program, const char *name)
+{
+	unsigned int hash = 2166136261u ^ program;
+	for (const char *c = name; *c != '\0'; c++) hash = (hash ^ (unsigned char)*c)*16777619u;
+	return hash;
+}
+
+// Get uniform value slot of a program location (empty slot if not cached), NULL if not cached and table is full
+static UniformValue *GetUniformValueSlot(unsigned int program, int location)
+{
+	unsigned int mask = uniformCache.valuesCapacity - 1;
+	unsigned int i = ((program*2654435761u) ^ ((unsigned int)location*40503u)) & mask;
+	for (int probes = 0; probes < uniformCache.valuesCapacity; probes++, i = (i + 1) & mask)
+	{
+		UniformValue *slot = &uniformCache.values[i];
+		if ((slot->program == 0) || ((slot->program == program) && (slot->location == location))) return slot;
+	}
+	return NULL;
+}
+
+// Get uniform name slot of a program (empty slot if not cached), NULL if not cached and table is full
+static UniformName *GetUniformNameSlot(unsigned int program, const char *name, unsigned int hash)
+{
+	unsigned int mask = uniformCache.namesCapacity - 1;
+	unsigned int i = hash & mask;
+	for (int probes = 0; probes < uniformCache.namesCapacity; probes++, i = (i + 1) & mask)
+	{
+		UniformName *slot = &uniformCache.names[i];
+		if ((slot->program == 0) || ((slot->program == program) && (slot->hash == hash) && (strcmp(slot->name, name) == 0))) return slot;
+	}
+	return NULL;
+}
+
+// Grow (or rebuild without a program entries) uniform values table
+static bool RehashUniformValues(int capacity, unsigned int forgetProgram)
+{
+	UniformValue *values = uniformCache.values;
+	int count = uniformCache.valuesCapacity;
+	uniformCache.values = (UniformValue *)calloc(capacity, sizeof(UniformValue));
+	if (uniformCache.values == NULL)
+	{
+		uniformCache.values = values;
+		return false;
+	}
+	uniformCache.valuesCapacity = capacity;
+	uniformCache.valuesCount = 0;
+	for (int i = 0; i < count; i++)
+	{
+		if ((values[i].program == 0) || (values[i].program == forgetProgram)) continue;
+		UniformValue *slot = GetUniformValueSlot(values[i].program, values[i].location);
+		if (slot == NULL) continue;
+		*slot = values[i];
+		uniformCache.valuesCount++;
+	}
+	free(values);
+	return true;
+}
+
+// Grow (or rebuild without a program entries) uniform names table
+static bool RehashUniformNames(int capacity, unsigned int forgetProgram)
+{
+	UniformName *names = uniformCache.names;
+	int count = uniformCache.namesCapacity;
+	uniformCache.names = (UniformName *)calloc(capacity, sizeof(UniformName));
+	if (uniformCache.names == NULL)
+	{
+		uniformCache.names = names;
+		return false;
+	}
+	uniformCache.namesCapacity = capacity;
+	uniformCache.namesCount = 0;
+	for (int i = 0; i < count; i++)
+	{
+		if (names[i].program == 0) continue;
+		if (names[i].program == forgetProgram)
+		{
+			free(names[i].name);
+			continue;
+		}
+		UniformName *slot = GetUniformNameSlot(names[i].program, names[i].name, names[i].hash);
+		if (slot == NULL)
+		{
+			free(names[i].name);
+			continue;
+		}
+		*slot = names[i];
+		uniformCache.namesCount++;
+	}
+	free(names);
+	return true;
+}
+
+// Upload uniform value (program must be in use), skipped if same value was already uploaded
+// NOTE: Values up to UNIFORM_CACHE_VALUE_SIZE bytes are cached, bigger arrays always upload
+void SetUniformCached(unsigned int program, int uniformLoc, int uniformType, const void *value, int count)
+{
+	if (uniformLoc < 0) return;     // Uniform not active, GL ignores it
+	int size = GetUniformTypeSize(uniformType)*count;
+	UniformValue *entry = NULL;
+	if (program != 0)
+	{
+		bool full = false;
+		if ((uniformCache.valuesCount + 1)*4 > uniformCache.valuesCapacity*3) full = !RehashUniformValues((uniformCache.valuesCapacity > 0)? uniformCache.valuesCapacity*2 : UNIFORM_CACHE_CAPACITY, 0);
+		if (uniformCache.valuesCapacity > 0) entry = GetUniformValueSlot(program, uniformLoc);
+		if ((entry != NULL) && (entry->program == 0) && full) entry = NULL;     // Table could not grow, value uploaded without caching
+	}
+	if ((entry != NULL) && (entry->program != 0) && (entry->type == uniformType) && (entry->size == size) && (memcmp(entry->value, value, size) == 0))
+	{
+		RLGL.Cache.uniformsSkipped++;
+		return;
+	}
+	switch (uniformType)
+	{
+		case UNIFORM_FLOAT: glUniform1fv(uniformLoc, count, (float *)value); break;
+		case UNIFORM_VEC2: glUniform2fv(uniformLoc, count, (float *)value); break;
+		case UNIFORM_VEC3: glUniform3fv(uniformLoc, count, (float *)value); break;
+		case UNIFORM_VEC4: glUniform4fv(uniformLoc, count, (float *)value); break;
+		case UNIFORM_INT: glUniform1iv(uniformLoc, count, (int *)value); break;
+		case UNIFORM_IVEC2: glUniform2iv(uniformLoc, count, (int *)value); break;
+		case UNIFORM_IVEC3: glUniform3iv(uniformLoc, count, (int *)value); break;
+		case UNIFORM_IVEC4: glUniform4iv(uniformLoc, count, (int *)value); break;
+		case UNIFORM_SAMPLER2D: glUniform1iv(uniformLoc, count, (int *)value); break;
+		case UNIFORM_MATRIX: glUniformMatrix4fv(uniformLoc, count, false, (float *)value); break;
+		default:
+		{
+			debugNetPrintf(ERROR, "[ORBISGL] %s Shader uniform could not be set data type not recognized\n",__FUNCTION__);
+			return;
+		}
+	}
+	if (entry == NULL) return;
+	if (entry->program == 0) uniformCache.valuesCount++;
+	entry->program = program;
+	entry->location = uniformLoc;
+	entry->type = uniformType;
+	if (size <= UNIFORM_CACHE_VALUE_SIZE)
+	{
+		entry->size = size;
+		memcpy(entry->value, value, size);
+	}
+	else entry->size = -1;          // Value not kept, next upload can not be skipped
+}
+
+// Find cached uniform location of a program by name
+bool FindUniformLocationCached(unsigned int program, const char *name, int *location)
+{
+	if (uniformCache.namesCapacity == 0) return false;
+	UniformName *entry = GetUniformNameSlot(program, name, HashUniformName(program, name));
+	if ((entry == NULL) || (entry->program == 0)) return false;
+	*location = entry->location;
+	return true;
+}
+
+// Cache uniform location of a program by name
+void AddUniformLocationCached(unsigned int program, const char *name, int location)
+{
+	if (program == 0) return;
+	if ((uniformCache.namesCount + 1)*4 > uniformCache.namesCapacity*3)
+	{
+		if (!RehashUniformNames((uniformCache.namesCapacity > 0)? uniformCache.namesCapacity*2 : UNIFORM_CACHE_CAPACITY, 0)) return;
+	}
+	unsigned int hash = HashUniformName(program, name);
+	UniformName *entry = GetUniformNameSlot(program, name, hash);
+	if (entry == NULL) return;
+	if (entry->program == 0)
+	{
+		entry->name = (char *)malloc(strlen(name) + 1);
+		if (entry->name == NULL) return;
+		strcpy(entry->name, name);
+		entry->program = program;
+		entry->hash = hash;
+		uniformCache.namesCount++;
+	}
+	entry->location = location;
+}
+
+// Drop a program uniform locations and values (program deleted, its id can be reused)
+void ForgetUniformsCached(unsigned int program)
+{
+	if (uniformCache.valuesCapacity > 0) RehashUniformValues(uniformCache.valuesCapacity, program);
+	if (uniformCache.namesCapacity > 0) RehashUniformNames(uniformCache.namesCapacity, program);
+}
+
+// Drop all uniform values (uniforms could have been set directly with GL), locations are kept
+void ResetUniformsCached(void)
+{
+	if (uniformCache.values != NULL) memset(uniformCache.values, 0, sizeof(UniformValue)*uniformCache.valuesCapacity);
+	uniformCache.valuesCount = 0;
+}
+
+// Unload uniform tables
+void UnloadUniformsCached(void)
+{
+	for (int i = 0; i < uniformCache.namesCapacity; i++) free(uniformCache.names[i].name);
+	free(uniformCache.names);
+	free(uniformCache.values);
+	memset(&uniformCache, 0, sizeof(uniformCache));
+}
+
+// Move state cache counters of current frame to last frame ones
+static void EndFrameCached(void)
+{
+	RLGL.Cache.lastFrameElidedCalls = RLGL.Cache.elidedCalls;
+	RLGL.Cache.lastFrameTextureBinds = RLGL.Cache.textureBinds;
+	RLGL.Cache.lastFrameUniformsSkipped = RLGL.Cache.uniformsSkipped;
+	RLGL.Cache.elidedCalls = 0;
+	RLGL.Cache.textureBinds = 0;
+	RLGL.Cache.uniformsSkipped = 0;
+}
+
+// Get state cache counters of last frame
+static void GetFrameStatsCached(FrameStats *stats)
+{
+	stats->stateCallsElided = RLGL.Cache.lastFrameElidedCalls;
+	stats->textureBinds = RLGL.Cache.lastFrameTextureBinds;
+	stats->uniformUploadsSkipped = RLGL.Cache.lastFrameUniformsSkipped;
+}
+
+// Compile custom shader and return shader id
+unsigned int CompileShader(const char *shaderStr, int type)
+{
+	unsigned int shader = glCreateShader(type);
+	glShaderSource(shader, 1, &shaderStr, NULL);
+	GLint success = 0;
+	glCompileShader(shader);
+	glGetShaderiv(shader, GL_COMPILE_STATUS, &success);
+	if (success != GL_TRUE)
+	{
+		debugNetPrintf(ERROR, "[ORBISGL] %s [SHDR ID %i] Failed to compile shader...\n",__FUNCTION__,shader);
+		int maxLength = 0;
+		int length;
+		glGetShaderiv(shader, GL_INFO_LOG_LENGTH, &maxLength);
+		char log[maxLength];
+		glGetShaderInfoLog(shader, maxLength, &length, log);
+		debugNetPrintf(INFO, "[ORBISGL] %s %s\n",__FUNCTION__,log);
+	}
+	else debugNetPrintf(INFO, "[ORBISGL] %s [SHDR ID %i] Shader compiled successfully\n",__FUNCTION__,shader);
+	return shader;
+}
+
+// Load custom shader strings and return program id
+unsigned int LoadShaderProgram(unsigned int vShaderId, unsigned int fShaderId)
+{
+	unsigned int program = 0;
+	GLint success = 0;
+	program = glCreateProgram();
+	glAttachShader(program, vShaderId);
+	glAttachShader(program, fShaderId);
+	// NOTE: Default attribute shader locations must be binded before linking
+	glBindAttribLocation(program, 0, DEFAULT_ATTRIB_POSITION_NAME);
+	glBindAttribLocation(program, 1, DEFAULT_ATTRIB_TEXCOORD_NAME);
+	glBindAttribLocation(program, 2, DEFAULT_ATTRIB_NORMAL_NAME);
+	glBindAttribLocation(program, 3, DEFAULT_ATTRIB_COLOR_NAME);
+	glBindAttribLocation(program, 4, DEFAULT_ATTRIB_TANGENT_NAME);
+	glBindAttribLocation(program, 5, DEFAULT_ATTRIB_TEXCOORD2_NAME);
+	glBindAttribLocation(program, 6, DEFAULT_ATTRIB_BONEIDS_NAME);
+	glBindAttribLocation(program, 7, DEFAULT_ATTRIB_BONEWEIGHTS_NAME);
+	// NOTE: If some attrib name is no found on the shader, it locations becomes -1
+	glLinkProgram(program);
+	// NOTE: All uniform variables are intitialised to 0 when a program links
+	glGetProgramiv(program, GL_LINK_STATUS, &success);
+	if (success == GL_FALSE)
+	{
+		debugNetPrintf(ERROR, "[ORBISGL] %s [SHDR ID %i] Failed to link shader program...\n",__FUNCTION__,program);
+		int maxLength = 0;
+		int length;
+		glGetProgramiv(program, GL_INFO_LOG_LENGTH, &maxLength);
+		char log[maxLength];
+		glGetProgramInfoLog(program, maxLength, &length, log);
+		debugNetPrintf(INFO, "[ORBISGL] %s %s\n",__FUNCTION__, log);
+		glDeleteProgram(program);
+		program = 0;
+	}
+	else debugNetPrintf(INFO, "[ORBISGL] %s [SHDR ID %i] Shader program loaded successfully\n",__FUNCTION__,program);
+	return program;
+}
+
+// Hash program sources with driver version and renderer (FNV-1a)
+// NOTE: A driver update changes the key, so stale binaries are never loaded
+static unsigned long long HashProgramSources(const char *vsCode, const char *fsCode)
+{
+	const char *strings[4] = { vsCode, fsCode, (const char *)glGetString(GL_VERSION), (const char *)glGetString(GL_RENDERER) };
+	unsigned long long hash = 14695981039346656037ull;
+	for (int i = 0; i < 4; i++)
+	{
+		if (strings[i] != NULL) for (const char *c = strings[i]; *c != '\0'; c++) hash = (hash ^ (unsigned char)*c)*1099511628211ull;
+		hash = (hash ^ 0xff)*1099511628211ull;     // Strings separator
+	}
+	return hash;
+}
+
+// Get cache file path of a program binary
+static void GetProgramBinaryPath(unsigned long long key, char *path, int size)
+{
+	snprintf(path, size, "%s/%016llx.bin", shaderCacheDirectory, key);
+}
+
+// Get shader code with features defines injected (after #version directive if any)
+// NOTE: Returned string must be freed, #line keeps compile errors at source line numbers
+static char *LoadShaderVariantCode(const char *code, unsigned int features)
+{
+	const char *body = code;
+	while ((*body == ' ') || (*body == '\t') || (*body == '\r') || (*body == '\n')) body++;
+	if (strncmp(body, "#version", 8) == 0)
+	{
+		body = strchr(body, '\n');
+		body = (body != NULL)? body + 1 : code + strlen(code);
+	}
+	else body = code;
+	int line = 1;
+	for (const char *c = code; c < body; c++) if (*c == '\n') line++;
+	int size = strlen(code) + 64;
+	for (int i = 0; i < (int)(sizeof(shaderFeatureDefines)/sizeof(shaderFeatureDefines[0])); i++) if (features & (1 << i)) size += strlen(shaderFeatureDefines[i]) + 10;
+	char *variantCode = (char *)malloc(size);
+	if (variantCode == NULL) return NULL;
+	int length = body - code;
+	memcpy(variantCode, code, length);
+	for (int i = 0; i < (int)(sizeof(shaderFeatureDefines)/sizeof(shaderFeatureDefines[0])); i++)
+	{
+		if (features & (1 << i)) length += sprintf(variantCode + length, "#define %s\n", shaderFeatureDefines[i]);
+	}
+	if (features & SHADER_FEATURE_SKINNING) length += sprintf(variantCode + length, "#define MAX_SKINNING_BONES %i\n", MAX_SKINNING_BONES);
+	length += sprintf(variantCode + length, "#line %i\n", line);
+	strcpy(variantCode + length, body);
+	return variantCode;
+}
+
+// Load program binary cached for sources, returns 0 if not cached or rejected by driver
+// NOTE: Returned program is linked, attribute locations are the ones bound when it was saved
+unsigned int LoadProgramBinaryCached(const char *vsCode, const char *fsCode)
+{
+	if ((shaderCacheDirectory == NULL) || !RLGL.ExtSupported.programBinary) return 0;
+	unsigned long long key = HashProgramSources(vsCode, fsCode);
+	char path[512];
+	GetProgramBinaryPath(key, path, sizeof(path));
+	int file = orbisNfsOpen(path, O_RDONLY, 0);
+	if (file < 0) return 0;
+	ProgramBinaryHeader header = { 0 };
+	unsigned char *binary = NULL;
+	unsigned int program = 0;
+	if ((orbisNfsRead(file, &header, sizeof(header)) == sizeof(header)) && (header.magic == PROGRAM_BINARY_MAGIC) &&
+		(header.version == PROGRAM_BINARY_VERSION) && (header.key == key) && (header.length > 0))
+	{
+		binary = (unsigned char *)malloc(header.length);
+		if ((binary != NULL) && (orbisNfsRead(file, binary, header.length) != header.length))
+		{
+			free(binary);
+			binary = NULL;
+		}
+	}
+	if (binary != NULL)
+	{
+		GLint success = 0;
+		program = glCreateProgram();
+		glProgramBinary(program, header.format, binary, header.length);
+		glGetProgramiv(program, GL_LINK_STATUS, &success);
+		if (success == GL_FALSE)
+		{
+			debugNetPrintf(INFO, "[ORBISGL] %s [SHDR ID %i] Cached program binary rejected by driver\n",__FUNCTION__,program);
+			glDeleteProgram(program);
+			program = 0;
+		}
+		free(binary);
+	}
+	else debugNetPrintf(ERROR, "[ORBISGL] %s FILEIO: [%s] Invalid program binary cache file\n",__FUNCTION__,path);
+	orbisNfsClose(file);
+	return program;
+}
+
+// Save linked program binary to cache, next loads of same sources skip compile and link
+void SaveProgramBinaryCached(unsigned int program, const char *vsCode, const char *fsCode)
+{
+	if ((shaderCacheDirectory == NULL) || !RLGL.ExtSupported.programBinary || (program == 0)) return;
+	ProgramBinaryHeader header = { PROGRAM_BINARY_MAGIC, PROGRAM_BINARY_VERSION, 0, 0, HashProgramSources(vsCode, fsCode) };
+	glGetProgramiv(program, GL_PROGRAM_BINARY_LENGTH_OES, &header.length);
+	if (header.length <= 0) return;
+	unsigned char *binary = (unsigned char *)malloc(header.length);
+	if (binary == NULL) return;
+	GLsizei length = 0;
+	glGetProgramBinary(program, header.length, &length, &header.format, binary);
+	header.length = length;
+	char path[512];
+	GetProgramBinaryPath(header.key, path, sizeof(path));
+	int file = (length > 0)? orbisNfsOpen(path, O_WRONLY | O_CREAT | O_TRUNC, 0644) : -1;
+	if (file >= 0)
+	{
+		if ((orbisNfsWrite(file, &header, sizeof(header)) == sizeof(header)) && (orbisNfsWrite(file, binary, length) == length))
+		{
+			debugNetPrintf(INFO, "[ORBISGL] %s [SHDR ID %i] FILEIO: [%s] Program binary saved (%i bytes)\n",__FUNCTION__,program,path,length);
+		}
+		else debugNetPrintf(ERROR, "[ORBISGL] %s FILEIO: [%s] Failed to write program binary\n",__FUNCTION__,path);
+		orbisNfsClose(file);
+	}
+	else debugNetPrintf(ERROR, "[ORBISGL] %s FILEIO: [%s] Failed to save program binary\n",__FUNCTION__,path);
+	free(binary);
+}
+
+
+// Load default shader (just vertex positioning and texture coloring)
+// NOTE: This shader program is used for internal buffers
+Shader LoadShaderDefault(void)
+{
+	Shader shader = { 0 };
+	shader.locs = (int *)calloc(MAX_SHADER_LOCATIONS, sizeof(int));
+	// NOTE: All locations must be reseted to -1 (no location)
+	for (int i = 0; i < MAX_SHADER_LOCATIONS; i++) shader.locs[i] = -1;
 	// NOTE: Compiled vertex/fragment shaders are kept for re-use
-	RLGL.State.defaultVShaderId = CompileShader(defaultVShaderStr, GL_VERTEX_SHADER);     // Compile default vertex shader
-	RLGL.State.defaultFShaderId = CompileShader(defaultFShaderStr, GL_FRAGMENT_SHADER);   // Compile default fragment shader
+	RLGL.State.defaultVShaderId = CompileShader(defaultVShaderCode, GL_VERTEX_SHADER);     // Compile default vertex shader
+	RLGL.State.defaultFShaderId = CompileShader(defaultFShaderCode, GL_FRAGMENT_SHADER);   // Compile default fragment shader
 	shader.id = LoadShaderProgram(RLGL.State.defaultVShaderId, RLGL.State.defaultFShaderId);
 	if (shader.id > 0)
 	{
@@ -2168,6 +4656,8 @@ void SetShaderDefaultLocations(Shader *shader)
 	//          vertex color location       = 3
 	//          vertex tangent location     = 4
 	//          vertex texcoord2 location   = 5
+	//          vertex bone ids location    = 6
+	//          vertex bone weights location = 7
 	// Get handles to GLSL input attibute locations
 	shader->locs[LOC_VERTEX_POSITION] = glGetAttribLocation(shader->id, DEFAULT_ATTRIB_POSITION_NAME);
 	shader->locs[LOC_VERTEX_TEXCOORD01] = glGetAttribLocation(shader->id, DEFAULT_ATTRIB_TEXCOORD_NAME);
@@ -2175,10 +4665,13 @@ void SetShaderDefaultLocations(Shader *shader)
 	shader->locs[LOC_VERTEX_NORMAL] = glGetAttribLocation(shader->id, DEFAULT_ATTRIB_NORMAL_NAME);
 	shader->locs[LOC_VERTEX_TANGENT] = glGetAttribLocation(shader->id, DEFAULT_ATTRIB_TANGENT_NAME);
 	shader->locs[LOC_VERTEX_COLOR] = glGetAttribLocation(shader->id, DEFAULT_ATTRIB_COLOR_NAME);
+	shader->locs[LOC_VERTEX_BONEIDS] = glGetAttribLocation(shader->id, DEFAULT_ATTRIB_BONEIDS_NAME);
+	shader->locs[LOC_VERTEX_BONEWEIGHTS] = glGetAttribLocation(shader->id, DEFAULT_ATTRIB_BONEWEIGHTS_NAME);
 	// Get handles to GLSL uniform locations (vertex shader)
 	shader->locs[LOC_MATRIX_MVP]  = glGetUniformLocation(shader->id, "mvp");
 	shader->locs[LOC_MATRIX_PROJECTION]  = glGetUniformLocation(shader->id, "projection");
 	shader->locs[LOC_MATRIX_VIEW]  = glGetUniformLocation(shader->id, "view");
+	shader->locs[LOC_MATRIX_BONES]  = glGetUniformLocation(shader->id, "boneMatrices");
 	// Get handles to GLSL uniform locations (fragment shader)
 	shader->locs[LOC_COLOR_DIFFUSE] = glGetUniformLocation(shader->id, "colDiffuse");
 	shader->locs[LOC_MAP_DIFFUSE] = glGetUniformLocation(shader->id, "texture0");
@@ -2189,12 +4682,13 @@ void SetShaderDefaultLocations(Shader *shader)
 // Unload default shader
 void UnloadShaderDefault(void)
 {
-	glUseProgram(0);
+	UseProgramCached(0);
 	glDetachShader(RLGL.State.defaultShader.id, RLGL.State.defaultVShaderId);
 	glDetachShader(RLGL.State.defaultShader.id, RLGL.State.defaultFShaderId);
 	glDeleteShader(RLGL.State.defaultVShaderId);
 	glDeleteShader(RLGL.State.defaultFShaderId);
 	glDeleteProgram(RLGL.State.defaultShader.id);
+	ForgetObjectCached(GL_CURRENT_PROGRAM, RLGL.State.defaultShader.id);
 }
 
 // to check locs content is good from different c files
@@ -2223,34 +4717,49 @@ void LoadBuffersDefault(void)
 {
 	//checkshader(RLGL.State.defaultShader,4);
 
-	// Initialize CPU (RAM) arrays (vertex position, texcoord, color data and indexes)
+	// Initialize CPU (RAM) arrays (interleaved vertex data and indexes)
 	//--------------------------------------------------------------------------------------------
 	for (int i = 0; i < MAX_BATCH_BUFFERING; i++)
 	{
-		RLGL.State.vertexData[i].vertices = (float *)malloc(sizeof(float)*3*4*MAX_BATCH_ELEMENTS);        // 3 float by vertex, 4 vertex by quad
-		RLGL.State.vertexData[i].texcoords = (float *)malloc(sizeof(float)*2*4*MAX_BATCH_ELEMENTS);       // 2 float by texcoord, 4 texcoord by quad
-		RLGL.State.vertexData[i].colors = (unsigned char *)malloc(sizeof(unsigned char)*4*4*MAX_BATCH_ELEMENTS);  // 4 float by color, 4 colors by quad
-		RLGL.State.vertexData[i].indices = (unsigned short *)malloc(sizeof(unsigned short)*6*MAX_BATCH_ELEMENTS);  // 6 int by quad (indices)
-		for (int j = 0; j < (3*4*MAX_BATCH_ELEMENTS); j++) RLGL.State.vertexData[i].vertices[j] = 0.0f;
-		for (int j = 0; j < (2*4*MAX_BATCH_ELEMENTS); j++) RLGL.State.vertexData[i].texcoords[j] = 0.0f;
-		for (int j = 0; j < (4*4*MAX_BATCH_ELEMENTS); j++) RLGL.State.vertexData[i].colors[j] = 0;
-		int k = 0;
-		// Indices can be initialized right now
-		for (int j = 0; j < (6*MAX_BATCH_ELEMENTS); j += 6)
-		{
-			RLGL.State.vertexData[i].indices[j] = 4*k;
-			RLGL.State.vertexData[i].indices[j + 1] = 4*k + 1;
-			RLGL.State.vertexData[i].indices[j + 2] = 4*k + 2;
-			RLGL.State.vertexData[i].indices[j + 3] = 4*k;
-			RLGL.State.vertexData[i].indices[j + 4] = 4*k + 2;
-			RLGL.State.vertexData[i].indices[j + 5] = 4*k + 3;
-			k++;
+		RLGL.State.vertexData[i].vertices = (BatchVertex *)calloc(4*RLGL.State.batchElements, sizeof(BatchVertex));     // 4 vertex by quad
+		if (RLGL.State.indexType == GL_UNSIGNED_INT)
+		{
+			unsigned int *indices = (unsigned int *)malloc(sizeof(unsigned int)*6*RLGL.State.batchElements);  // 6 int by quad (indices)
+			// Indices can be initialized right now
+			for (int j = 0, k = 0; j < (6*RLGL.State.batchElements); j += 6, k++)
+			{
+				indices[j] = 4*k;
+				indices[j + 1] = 4*k + 1;
+				indices[j + 2] = 4*k + 2;
+				indices[j + 3] = 4*k;
+				indices[j + 4] = 4*k + 2;
+				indices[j + 5] = 4*k + 3;
+			}
+			RLGL.State.vertexData[i].indices = indices;
+		}
+		else
+		{
+			unsigned short *indices = (unsigned short *)malloc(sizeof(unsigned short)*6*RLGL.State.batchElements);  // 6 short by quad (indices)
+			// Indices can be initialized right now
+			for (int j = 0, k = 0; j < (6*RLGL.State.batchElements); j += 6, k++)
+			{
+				indices[j] = 4*k;
+				indices[j + 1] = 4*k + 1;
+				indices[j + 2] = 4*k + 2;
+				indices[j + 3] = 4*k;
+				indices[j + 4] = 4*k + 2;
+				indices[j + 5] = 4*k + 3;
+			}
+			RLGL.State.vertexData[i].indices = indices;
 		}
 		RLGL.State.vertexData[i].vCounter = 0;
 		RLGL.State.vertexData[i].tcCounter = 0;
 		RLGL.State.vertexData[i].cCounter = 0;
+		RLGL.State.vertexData[i].inFlight = false;
 	}
-	debugNetPrintf(INFO, "[ORBISGL] %s Internal buffers initialized successfully (CPU)\n",__FUNCTION__);
+	RLGL.State.currentBuffer = 0;
+	RLGL.State.ringWrapsInFlight = 0;
+	debugNetPrintf(INFO, "[ORBISGL] %s Internal buffers initialized successfully (CPU, %i buffers, %i elements)\n",__FUNCTION__, MAX_BATCH_BUFFERING, RLGL.State.batchElements);
 	//--------------------------------------------------------------------------------------------
 	// Upload to GPU (VRAM) vertex data and initialize VAOs/VBOs
 	//--------------------------------------------------------------------------------------------
@@ -2260,36 +4769,136 @@ void LoadBuffersDefault(void)
 		{
 			// Initialize Quads VAO
 			glGenVertexArrays(1, &RLGL.State.vertexData[i].vaoId);
-			glBindVertexArray(RLGL.State.vertexData[i].vaoId);
+			BindVertexArrayCached(RLGL.State.vertexData[i].vaoId);
 		}
-		// Quads - Vertex buffers binding and attributes enable
-		// Vertex position buffer (shader-location = 0)
+		// Quads - Interleaved vertex buffer binding and attributes enable
 		glGenBuffers(1, &RLGL.State.vertexData[i].vboId[0]);
-		glBindBuffer(GL_ARRAY_BUFFER, RLGL.State.vertexData[i].vboId[0]);
-		glBufferData(GL_ARRAY_BUFFER, sizeof(float)*3*4*MAX_BATCH_ELEMENTS, RLGL.State.vertexData[i].vertices, GL_DYNAMIC_DRAW);
-		glEnableVertexAttribArray(RLGL.State.currentShader.locs[LOC_VERTEX_POSITION]);
-		glVertexAttribPointer(RLGL.State.currentShader.locs[LOC_VERTEX_POSITION], 3, GL_FLOAT, 0, 0, 0);
-		// Vertex texcoord buffer (shader-location = 1)
-		glGenBuffers(1, &RLGL.State.vertexData[i].vboId[1]);
-		glBindBuffer(GL_ARRAY_BUFFER, RLGL.State.vertexData[i].vboId[1]);
-		glBufferData(GL_ARRAY_BUFFER, sizeof(float)*2*4*MAX_BATCH_ELEMENTS, RLGL.State.vertexData[i].texcoords, GL_DYNAMIC_DRAW);
-		glEnableVertexAttribArray(RLGL.State.currentShader.locs[LOC_VERTEX_TEXCOORD01]);
-		glVertexAttribPointer(RLGL.State.currentShader.locs[LOC_VERTEX_TEXCOORD01], 2, GL_FLOAT, 0, 0, 0);
-		// Vertex color buffer (shader-location = 3)
-		glGenBuffers(1, &RLGL.State.vertexData[i].vboId[2]);
-		glBindBuffer(GL_ARRAY_BUFFER, RLGL.State.vertexData[i].vboId[2]);
-		glBufferData(GL_ARRAY_BUFFER, sizeof(unsigned char)*4*4*MAX_BATCH_ELEMENTS, RLGL.State.vertexData[i].colors, GL_DYNAMIC_DRAW);
-		glEnableVertexAttribArray(RLGL.State.currentShader.locs[LOC_VERTEX_COLOR]);
-		glVertexAttribPointer(RLGL.State.currentShader.locs[LOC_VERTEX_COLOR], 4, GL_UNSIGNED_BYTE, GL_TRUE, 0, 0);
+		BindBufferCached(GL_ARRAY_BUFFER, RLGL.State.vertexData[i].vboId[0]);
+		glBufferData(GL_ARRAY_BUFFER, sizeof(BatchVertex)*4*RLGL.State.batchElements, RLGL.State.vertexData[i].vertices, GL_DYNAMIC_DRAW);
+		SetBufferAttribsDefault();
 		// Fill index buffer
-		glGenBuffers(1, &RLGL.State.vertexData[i].vboId[3]);
-		glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, RLGL.State.vertexData[i].vboId[3]);
-		glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(short)*6*MAX_BATCH_ELEMENTS, RLGL.State.vertexData[i].indices, GL_STATIC_DRAW);
+		glGenBuffers(1, &RLGL.State.vertexData[i].vboId[1]);
+		BindBufferCached(GL_ELEMENT_ARRAY_BUFFER, RLGL.State.vertexData[i].vboId[1]);
+		glBufferData(GL_ELEMENT_ARRAY_BUFFER, ((RLGL.State.indexType == GL_UNSIGNED_INT)? sizeof(int) : sizeof(short))*6*RLGL.State.batchElements, RLGL.State.vertexData[i].indices, GL_STATIC_DRAW);
 	}
 	debugNetPrintf(INFO, "[ORBISGL] %s Internal buffers uploaded successfully (GPU)\n",__FUNCTION__);
 	// Unbind the current VAO
-	if (RLGL.ExtSupported.vao) glBindVertexArray(0);
+	if (RLGL.ExtSupported.vao) BindVertexArrayCached(0);
 	//--------------------------------------------------------------------------------------------
+	// Init deferred transforms tracking system
+	RLGL.State.transformSpans = (TransformSpan *)malloc(sizeof(TransformSpan)*RLGL.State.batchElements);
+	RLGL.State.transformSpansCounter = 0;
+	RLGL.State.transformSpanActive = false;
+	RLGL.State.transformDirty = true;
+	// Init unordered regions scratch arrays
+	RLGL.State.sortVertices = (BatchVertex *)malloc(sizeof(BatchVertex)*4*RLGL.State.batchElements);
+	RLGL.State.sortDraws = (DrawCall *)malloc(sizeof(DrawCall)*RLGL.State.maxDrawCalls);
+	// Init draw calls tracking system
+	RLGL.State.draws = (DrawCall *)malloc(sizeof(DrawCall)*RLGL.State.maxDrawCalls);
+	for (int i = 0; i < RLGL.State.maxDrawCalls; i++)
+	{
+		RLGL.State.draws[i].mode = RL_QUADS;
+		RLGL.State.draws[i].vertexCount = 0;
+		RLGL.State.draws[i].vertexAlignment = 0;
+		RLGL.State.draws[i].shader = RLGL.State.currentShader;
+		RLGL.State.draws[i].blendMode = RLGL.State.currentBlendMode;
+		RLGL.State.draws[i].textureId = RLGL.State.defaultTextureId;
+	}
+	RLGL.State.drawsCounter = 1;
+}
+
+// Set GL blend function for a blending mode
+void SetBlendModeDefault(int mode)
+{
+	if (RenderThreadRecording())
+	{
+		RenderThreadPushParams(RC_BLEND_MODE, mode, 0, 0, 0);
+		return;
+	}
+	switch (mode)
+	{
+		case BLEND_ALPHA: BlendFuncCached(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA); break;
+		case BLEND_ADDITIVE: BlendFuncCached(GL_SRC_ALPHA, GL_ONE); break; // Alternative: glBlendFunc(GL_ONE, GL_ONE);
+		case BLEND_MULTIPLIED: BlendFuncCached(GL_DST_COLOR, GL_ONE_MINUS_SRC_ALPHA); break;
+		default: break;
+	}
+}
+
+// Transform vertex positions of a batch range by a matrix
+// NOTE: SSE/NEON path loads and stores every position as one contiguous vector (xyz and texcoord u),
+// position is transformed as matrix columns scaled by x, y, z and u is written back unchanged
+static void TransformVertexRange(BatchVertex *vertices, int count, const Matrix *mat)
+{
+#if defined(__SSE__)
+	const __m128 col0 = _mm_setr_ps(mat->m0, mat->m1, mat->m2, 0.0f);
+	const __m128 col1 = _mm_setr_ps(mat->m4, mat->m5, mat->m6, 0.0f);
+	const __m128 col2 = _mm_setr_ps(mat->m8, mat->m9, mat->m10, 0.0f);
+	const __m128 col3 = _mm_setr_ps(mat->m12, mat->m13, mat->m14, 0.0f);
+	for (int i = 0; i < count; i++)
+	{
+		float *position = vertices[i].position;
+		__m128 v = _mm_loadu_ps(position);
+		__m128 r = _mm_add_ps(_mm_add_ps(_mm_mul_ps(col0, _mm_shuffle_ps(v, v, _MM_SHUFFLE(0, 0, 0, 0))), _mm_mul_ps(col1, _mm_shuffle_ps(v, v, _MM_SHUFFLE(1, 1, 1, 1)))),
+							  _mm_add_ps(_mm_mul_ps(col2, _mm_shuffle_ps(v, v, _MM_SHUFFLE(2, 2, 2, 2))), col3));
+		// Result x, y, z with original u on last lane
+		__m128 zu = _mm_shuffle_ps(r, v, _MM_SHUFFLE(3, 3, 2, 2));
+		_mm_storeu_ps(position, _mm_shuffle_ps(r, zu, _MM_SHUFFLE(2, 0, 1, 0)));
+	}
+#elif defined(__ARM_NEON)
+	const float32x4_t col0 = { mat->m0, mat->m1, mat->m2, 0.0f };
+	const float32x4_t col1 = { mat->m4, mat->m5, mat->m6, 0.0f };
+	const float32x4_t col2 = { mat->m8, mat->m9, mat->m10, 0.0f };
+	const float32x4_t col3 = { mat->m12, mat->m13, mat->m14, 0.0f };
+	for (int i = 0; i < count; i++)
+	{
+		float *position = vertices[i].position;
+		float32x4_t v = vld1q_f32(position);
+		float32x4_t r = vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(col3, col0, vgetq_lane_f32(v, 0)), col1, vgetq_lane_f32(v, 1)), col2, vgetq_lane_f32(v, 2));
+		vst1q_f32(position, vsetq_lane_f32(vgetq_lane_f32(v, 3), r, 3));
+	}
+#else
+	for (int i = 0; i < count; i++)
+	{
+		float *v = vertices[i].position;
+		float x = v[0], y = v[1], z = v[2];
+		v[0] = mat->m0*x + mat->m4*y + mat->m8*z + mat->m12;
+		v[1] = mat->m1*x + mat->m5*y + mat->m9*z + mat->m13;
+		v[2] = mat->m2*x + mat->m6*y + mat->m10*z + mat->m14;
+	}
+#endif
+}
+
+// Apply deferred vertex transforms on current buffer
+// NOTE: Called right before UpdateBuffersDefault(), spans are consumed
+void TransformBuffersDefault(void)
+{
+	DynamicBuffer *buffer = &RLGL.State.vertexData[RLGL.State.currentBuffer];
+	// Close last span, it ends on current vertex
+	if (RLGL.State.transformSpanActive)
+	{
+		TransformSpan *span = &RLGL.State.transformSpans[RLGL.State.transformSpansCounter - 1];
+		span->vertexCount = buffer->vCounter - span->firstVertex;
+		RLGL.State.transformSpanActive = false;
+	}
+	for (int i = 0; i < RLGL.State.transformSpansCounter; i++)
+	{
+		if (RLGL.State.transformSpans[i].vertexCount > 0) TransformVertexRange(&buffer->vertices[RLGL.State.transformSpans[i].firstVertex], RLGL.State.transformSpans[i].vertexCount, &RLGL.State.transformSpans[i].transform);
+	}
+	RLGL.State.transformSpansCounter = 0;
+	// Vertex following (if any) must open a new span
+	RLGL.State.transformDirty = true;
+}
+
+// Set default vertex attribs for the interleaved vertex buffer currently bound
+// NOTE: All attribs share the BatchVertex stride, offsets point inside the struct
+void SetBufferAttribsDefault(void)
+{
+	glVertexAttribPointer(RLGL.State.currentShader.locs[LOC_VERTEX_POSITION], 3, GL_FLOAT, GL_FALSE, sizeof(BatchVertex), (GLvoid *)offsetof(BatchVertex, position));
+	glEnableVertexAttribArray(RLGL.State.currentShader.locs[LOC_VERTEX_POSITION]);
+	glVertexAttribPointer(RLGL.State.currentShader.locs[LOC_VERTEX_TEXCOORD01], 2, GL_FLOAT, GL_FALSE, sizeof(BatchVertex), (GLvoid *)offsetof(BatchVertex, texcoord));
+	glEnableVertexAttribArray(RLGL.State.currentShader.locs[LOC_VERTEX_TEXCOORD01]);
+	glVertexAttribPointer(RLGL.State.currentShader.locs[LOC_VERTEX_COLOR], 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(BatchVertex), (GLvoid *)offsetof(BatchVertex, color));
+	glEnableVertexAttribArray(RLGL.State.currentShader.locs[LOC_VERTEX_COLOR]);
 }
 
 // Update default internal buffers (VAOs/VBOs) with vertex array data
@@ -2297,119 +4906,154 @@ void LoadBuffersDefault(void)
 // TODO: If no data changed on the CPU arrays --> No need to re-update GPU arrays (change flag required)
 void UpdateBuffersDefault(void)
 {
+	BeginProfileScope("UpdateBuffersDefault");
 	// Update vertex buffers data
 	if (RLGL.State.vertexData[RLGL.State.currentBuffer].vCounter > 0)
 	{
-		// Activate elements VAO
-		if (RLGL.ExtSupported.vao) glBindVertexArray(RLGL.State.vertexData[RLGL.State.currentBuffer].vaoId);
-		// Vertex positions buffer
-		glBindBuffer(GL_ARRAY_BUFFER, RLGL.State.vertexData[RLGL.State.currentBuffer].vboId[0]);
-		glBufferSubData(GL_ARRAY_BUFFER, 0, sizeof(float)*3*RLGL.State.vertexData[RLGL.State.currentBuffer].vCounter, RLGL.State.vertexData[RLGL.State.currentBuffer].vertices);
-		//glBufferData(GL_ARRAY_BUFFER, sizeof(float)*3*4*MAX_BATCH_ELEMENTS, RLGL.State.vertexData[RLGL.State.currentBuffer].vertices, GL_DYNAMIC_DRAW);  // Update all buffer
-		// Texture coordinates buffer
-		glBindBuffer(GL_ARRAY_BUFFER, RLGL.State.vertexData[RLGL.State.currentBuffer].vboId[1]);
-		glBufferSubData(GL_ARRAY_BUFFER, 0, sizeof(float)*2*RLGL.State.vertexData[RLGL.State.currentBuffer].vCounter, RLGL.State.vertexData[RLGL.State.currentBuffer].texcoords);
-		//glBufferData(GL_ARRAY_BUFFER, sizeof(float)*2*4*MAX_BATCH_ELEMENTS, RLGL.State.vertexData[RLGL.State.currentBuffer].texcoords, GL_DYNAMIC_DRAW); // Update all buffer
-		// Colors buffer
-		glBindBuffer(GL_ARRAY_BUFFER, RLGL.State.vertexData[RLGL.State.currentBuffer].vboId[2]);
-		glBufferSubData(GL_ARRAY_BUFFER, 0, sizeof(unsigned char)*4*RLGL.State.vertexData[RLGL.State.currentBuffer].vCounter, RLGL.State.vertexData[RLGL.State.currentBuffer].colors);
-		//glBufferData(GL_ARRAY_BUFFER, sizeof(float)*4*4*MAX_BATCH_ELEMENTS, RLGL.State.vertexData[RLGL.State.currentBuffer].colors, GL_DYNAMIC_DRAW);    // Update all buffer
-		// NOTE: glMapBuffer() causes sync issue.
-		// If GPU is working with this buffer, glMapBuffer() will wait(stall) until GPU to finish its job.
-		// To avoid waiting (idle), you can call first glBufferData() with NULL pointer before glMapBuffer().
-		// If you do that, the previous data in PBO will be discarded and glMapBuffer() returns a new
-		// allocated pointer immediately even if GPU is still working with the previous data.
-		// Another option: map the buffer object into client's memory
-		// Probably this code could be moved somewhere else...
-		// RLGL.State.vertexData[RLGL.State.currentBuffer].vertices = (float *)glMapBuffer(GL_ARRAY_BUFFER, GL_READ_WRITE);
-		// if (RLGL.State.vertexData[RLGL.State.currentBuffer].vertices)
-		// {
-		    // Update vertex data
-		// }
-		// glUnmapBuffer(GL_ARRAY_BUFFER);
-		// Unbind the current VAO
-		if (RLGL.ExtSupported.vao) glBindVertexArray(0);
+		// Ring wrapped back onto a buffer the GPU could still be reading in this frame
+		if (RLGL.State.vertexData[RLGL.State.currentBuffer].inFlight) RLGL.State.ringWrapsInFlight++;
+		UploadBatchDefault(&RLGL.State.vertexData[RLGL.State.currentBuffer], RLGL.State.vertexData[RLGL.State.currentBuffer].vertices, RLGL.State.vertexData[RLGL.State.currentBuffer].vCounter);
+		RLGL.State.frameStats.bytesUploaded += sizeof(BatchVertex)*RLGL.State.vertexData[RLGL.State.currentBuffer].vCounter;
 	}
+	EndProfileScope();
+}
+
+// Upload batch vertex data to a default buffer VBO
+// NOTE: Used by UpdateBuffersDefault() and by render thread, it only touches buffer GPU objects
+void UploadBatchDefault(DynamicBuffer *buffer, const BatchVertex *vertices, int vCounter)
+{
+	// Activate elements VAO
+	if (RLGL.ExtSupported.vao) BindVertexArrayCached(buffer->vaoId);
+	// Interleaved vertex buffer (position, texcoord, color), uploaded in one go
+	BindBufferCached(GL_ARRAY_BUFFER, buffer->vboId[0]);
+	// Orphan previous storage so the upload never waits on a pending draw from this buffer
+	glBufferData(GL_ARRAY_BUFFER, sizeof(BatchVertex)*4*RLGL.State.batchElements, NULL, GL_DYNAMIC_DRAW);
+	glBufferSubData(GL_ARRAY_BUFFER, 0, sizeof(BatchVertex)*vCounter, vertices);
+	// NOTE: glMapBuffer() causes sync issue.
+	// If GPU is working with this buffer, glMapBuffer() will wait(stall) until GPU to finish its job.
+	// To avoid waiting (idle), you can call first glBufferData() with NULL pointer before glMapBuffer().
+	// If you do that, the previous data in PBO will be discarded and glMapBuffer() returns a new
+	// allocated pointer immediately even if GPU is still working with the previous data.
+	// Another option: map the buffer object into client's memory
+	// Probably this code could be moved somewhere else...
+	// RLGL.State.vertexData[RLGL.State.currentBuffer].vertices = (float *)glMapBuffer(GL_ARRAY_BUFFER, GL_READ_WRITE);
+	// if (RLGL.State.vertexData[RLGL.State.currentBuffer].vertices)
+	// {
+	    // Update vertex data
+	// }
+	// glUnmapBuffer(GL_ARRAY_BUFFER);
+	// Unbind the current VAO
+	if (RLGL.ExtSupported.vao) BindVertexArrayCached(0);
 }
 
 // Draw default internal buffers vertex data
 void DrawBuffersDefault(void)
 {
-	Matrix matProjection = RLGL.State.projection;
-	Matrix matModelView = RLGL.State.modelview;
+	BeginProfileScope("DrawBuffersDefault");
 	int eyesCount = 1;
 	for (int eye = 0; eye < eyesCount; eye++)
 	{
 		// Draw buffers
 		if (RLGL.State.vertexData[RLGL.State.currentBuffer].vCounter > 0)
 		{
-			// Set current shader and upload current MVP matrix
-			glUseProgram(RLGL.State.currentShader.id);
 			// Create modelview-projection matrix
-			Matrix matMVP = MatrixMultiply(RLGL.State.modelview, RLGL.State.projection);
-			glUniformMatrix4fv(RLGL.State.currentShader.locs[LOC_MATRIX_MVP], 1, false, MatrixToFloat(matMVP));
-			glUniform4f(RLGL.State.currentShader.locs[LOC_COLOR_DIFFUSE], 1.0f, 1.0f, 1.0f, 1.0f);
-			glUniform1i(RLGL.State.currentShader.locs[LOC_MAP_DIFFUSE], 0);    // Provided value refers to the texture unit (active)
-			// TODO: Support additional texture units on custom shader
-			//if (RLGL.State.currentShader->locs[LOC_MAP_SPECULAR] > 0) glUniform1i(RLGL.State.currentShader.locs[LOC_MAP_SPECULAR], 1);
-			//if (RLGL.State.currentShader->locs[LOC_MAP_NORMAL] > 0) glUniform1i(RLGL.State.currentShader.locs[LOC_MAP_NORMAL], 2);
-			// NOTE: Right now additional map textures not considered for default buffers drawing
-			int vertexOffset = 0;
-			if (RLGL.ExtSupported.vao) glBindVertexArray(RLGL.State.vertexData[RLGL.State.currentBuffer].vaoId);
-			else
-			{
-				// Bind vertex attrib: position (shader-location = 0)
-				glBindBuffer(GL_ARRAY_BUFFER, RLGL.State.vertexData[RLGL.State.currentBuffer].vboId[0]);
-				glVertexAttribPointer(RLGL.State.currentShader.locs[LOC_VERTEX_POSITION], 3, GL_FLOAT, 0, 0, 0);
-				glEnableVertexAttribArray(RLGL.State.currentShader.locs[LOC_VERTEX_POSITION]);
-				// Bind vertex attrib: texcoord (shader-location = 1)
-				glBindBuffer(GL_ARRAY_BUFFER, RLGL.State.vertexData[RLGL.State.currentBuffer].vboId[1]);
-				glVertexAttribPointer(RLGL.State.currentShader.locs[LOC_VERTEX_TEXCOORD01], 2, GL_FLOAT, 0, 0, 0);
-				glEnableVertexAttribArray(RLGL.State.currentShader.locs[LOC_VERTEX_TEXCOORD01]);
-				// Bind vertex attrib: color (shader-location = 3)
-				glBindBuffer(GL_ARRAY_BUFFER, RLGL.State.vertexData[RLGL.State.currentBuffer].vboId[2]);
-				glVertexAttribPointer(RLGL.State.currentShader.locs[LOC_VERTEX_COLOR], 4, GL_UNSIGNED_BYTE, GL_TRUE, 0, 0);
-				glEnableVertexAttribArray(RLGL.State.currentShader.locs[LOC_VERTEX_COLOR]);
-				glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, RLGL.State.vertexData[RLGL.State.currentBuffer].vboId[3]);
-			}
-			glActiveTexture(GL_TEXTURE0);
-			for (int i = 0; i < RLGL.State.drawsCounter; i++)
-			{
-				glBindTexture(GL_TEXTURE_2D, RLGL.State.draws[i].textureId);
-				// TODO: Find some way to bind additional textures --> Use global texture IDs? Register them on draw[i]?
-				//if (RLGL.State.currentShader->locs[LOC_MAP_SPECULAR] > 0) { glActiveTexture(GL_TEXTURE1); glBindTexture(GL_TEXTURE_2D, textureUnit1_id); }
-				//if (RLGL.State.currentShader->locs[LOC_MAP_SPECULAR] > 0) { glActiveTexture(GL_TEXTURE2); glBindTexture(GL_TEXTURE_2D, textureUnit2_id); }
-				if ((RLGL.State.draws[i].mode == RL_LINES) || (RLGL.State.draws[i].mode == RL_TRIANGLES)) glDrawArrays(RLGL.State.draws[i].mode, vertexOffset, RLGL.State.draws[i].vertexCount);
-				else
-				{
-				    glDrawElements(GL_TRIANGLES, RLGL.State.draws[i].vertexCount/4*6, GL_UNSIGNED_SHORT, (GLvoid *)(sizeof(GLushort)*vertexOffset/4*6));
-				}
-				vertexOffset += (RLGL.State.draws[i].vertexCount + RLGL.State.draws[i].vertexAlignment);
-			}
-			if (!RLGL.ExtSupported.vao)
-			{
-				glBindBuffer(GL_ARRAY_BUFFER, 0);
-				glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
-			}
-			glBindTexture(GL_TEXTURE_2D, 0);    // Unbind textures
+			// NOTE: Shader (and its MVP uniform) is set per draw, see DrawBatchDefault()
+			Matrix matMVP = GetViewProjection();
+			RLGL.State.frameStats.drawCalls += DrawBatchDefault(&RLGL.State.vertexData[RLGL.State.currentBuffer], RLGL.State.draws, RLGL.State.drawsCounter, matMVP, RLGL.State.currentBlendMode, RLGL.State.indexType);
+		}
+	}
+	RLGL.State.vertexData[RLGL.State.currentBuffer].inFlight = true;
+	ResetBuffersDefault();
+	EndProfileScope();
+}
+
+// Draw batch draws from a default buffer already uploaded, returns number of GL draw calls
+// NOTE: Used by DrawBuffersDefault() and by render thread, blendMode is the current (non batched) blending mode
+int DrawBatchDefault(DynamicBuffer *buffer, const DrawCall *draws, int drawsCount, Matrix matMVP, int currentBlendMode, unsigned int indexType)
+{
+	int drawCalls = 0;
+	unsigned int shaderId = 0;
+	int blendMode = currentBlendMode;   // GL blend function already set by BeginBlendMode()
+	float16 mvp = MatrixToFloatV(matMVP);
+	float colDiffuse[4] = { 1.0f, 1.0f, 1.0f, 1.0f };
+	int mapDiffuse = 0;
+	// TODO: Support additional texture units on custom shader
+	//if (RLGL.State.currentShader->locs[LOC_MAP_SPECULAR] > 0) glUniform1i(RLGL.State.currentShader.locs[LOC_MAP_SPECULAR], 1);
+	//if (RLGL.State.currentShader->locs[LOC_MAP_NORMAL] > 0) glUniform1i(RLGL.State.currentShader.locs[LOC_MAP_NORMAL], 2);
+	// NOTE: Right now additional map textures not considered for default buffers drawing
+	int vertexOffset = 0;
+	if (RLGL.ExtSupported.vao) BindVertexArrayCached(buffer->vaoId);
+	else
+	{
+		// Bind interleaved vertex attribs: position, texcoord, color (shader-location = 0, 1, 3)
+		BindBufferCached(GL_ARRAY_BUFFER, buffer->vboId[0]);
+		SetBufferAttribsDefault();
+		BindBufferCached(GL_ELEMENT_ARRAY_BUFFER, buffer->vboId[1]);
+	}
+	ActiveTextureCached(0);
+	for (int i = 0; i < drawsCount; i++)
+	{
+		if (draws[i].vertexCount == 0)
+		{
+			vertexOffset += draws[i].vertexAlignment;
+			continue;
+		}
+		// Switch shader and upload MVP matrix when draw shader changes
+		if (draws[i].shader.id != shaderId)
+		{
+			shaderId = draws[i].shader.id;
+			UseProgramCached(shaderId);
+			SetUniformCached(shaderId, draws[i].shader.locs[LOC_MATRIX_MVP], UNIFORM_MATRIX, mvp.v, 1);
+			SetUniformCached(shaderId, draws[i].shader.locs[LOC_COLOR_DIFFUSE], UNIFORM_VEC4, colDiffuse, 1);
+			SetUniformCached(shaderId, draws[i].shader.locs[LOC_MAP_DIFFUSE], UNIFORM_INT, &mapDiffuse, 1);    // Provided value refers to the texture unit (active)
+		}
+		// Switch blending mode when draw blending mode changes
+		if (draws[i].blendMode != blendMode)
+		{
+			blendMode = draws[i].blendMode;
+			SetBlendModeDefault(blendMode);
+		}
+		BindTextureCached(GL_TEXTURE_2D, draws[i].textureId);
+		// TODO: Find some way to bind additional textures --> Use global texture IDs? Register them on draw[i]?
+		//if (RLGL.State.currentShader->locs[LOC_MAP_SPECULAR] > 0) { glActiveTexture(GL_TEXTURE1); glBindTexture(GL_TEXTURE_2D, textureUnit1_id); }
+		//if (RLGL.State.currentShader->locs[LOC_MAP_SPECULAR] > 0) { glActiveTexture(GL_TEXTURE2); glBindTexture(GL_TEXTURE_2D, textureUnit2_id); }
+		if ((draws[i].mode == RL_LINES) || (draws[i].mode == RL_TRIANGLES)) glDrawArrays(draws[i].mode, vertexOffset, draws[i].vertexCount);
+		else
+		{
+		    glDrawElements(GL_TRIANGLES, draws[i].vertexCount/4*6, indexType, (GLvoid *)(((indexType == GL_UNSIGNED_INT)? sizeof(GLuint) : sizeof(GLushort))*vertexOffset/4*6));
 		}
-		if (RLGL.ExtSupported.vao) glBindVertexArray(0); // Unbind VAO
-		glUseProgram(0);    // Unbind shader program
+		drawCalls++;
+		vertexOffset += (draws[i].vertexCount + draws[i].vertexAlignment);
+	}
+	if (!RLGL.ExtSupported.vao)
+	{
+		BindBufferCached(GL_ARRAY_BUFFER, 0);
+		BindBufferCached(GL_ELEMENT_ARRAY_BUFFER, 0);
 	}
+	// Restore current blending mode for following (non batched) drawing
+	if (blendMode != currentBlendMode) SetBlendModeDefault(currentBlendMode);
+	if (RLGL.ExtSupported.vao) BindVertexArrayCached(0); // Unbind VAO
+	// NOTE: Last texture and shader program are kept bound, state cache skips
+	// rebinding them on next batch draw
+	return drawCalls;
+}
+
+// Reset current default buffer vertex counters and draws registry, and move to next buffer
+void ResetBuffersDefault(void)
+{
 	// Reset vertex counters for next frame
 	RLGL.State.vertexData[RLGL.State.currentBuffer].vCounter = 0;
 	RLGL.State.vertexData[RLGL.State.currentBuffer].tcCounter = 0;
 	RLGL.State.vertexData[RLGL.State.currentBuffer].cCounter = 0;
 	// Reset depth for next draw
 	RLGL.State.currentDepth = -1.0f;
-	// Restore projection/modelview matrices
-	RLGL.State.projection = matProjection;
-	RLGL.State.modelview = matModelView;
 	// Reset RLGL.State.draws array
-	for (int i = 0; i < MAX_DRAWCALL_REGISTERED; i++)
+	for (int i = 0; i < RLGL.State.maxDrawCalls; i++)
 	{
 		RLGL.State.draws[i].mode = RL_QUADS;
 		RLGL.State.draws[i].vertexCount = 0;
+		RLGL.State.draws[i].shader = RLGL.State.currentShader;
+		RLGL.State.draws[i].blendMode = RLGL.State.currentBlendMode;
 		RLGL.State.draws[i].textureId = RLGL.State.defaultTextureId;
 	}
 	RLGL.State.drawsCounter = 1;
@@ -2418,32 +5062,241 @@ void DrawBuffersDefault(void)
 	if (RLGL.State.currentBuffer >= MAX_BATCH_BUFFERING) RLGL.State.currentBuffer = 0;
 }
 
+// Append current buffer vertex data to the display list being recorded
+// NOTE: Quads are expanded to triangles (no index buffer required), consecutive draws
+// sharing all state are merged; buffer is reset as if it had been drawn
+void RecordBuffersDefault(void)
+{
+	DynamicBuffer *buffer = &RLGL.State.vertexData[RLGL.State.currentBuffer];
+	int vertexOffset = 0;
+	for (int i = 0; i < RLGL.State.drawsCounter; i++)
+	{
+		DrawCall draw = RLGL.State.draws[i];
+		BatchVertex *src = &buffer->vertices[vertexOffset];
+		vertexOffset += (draw.vertexCount + draw.vertexAlignment);
+		if (draw.vertexCount == 0) continue;
+		int count = (draw.mode == RL_QUADS)? draw.vertexCount/4*6 : draw.vertexCount;
+		// Grow list arrays as required
+		if ((RLGL.State.listVertexCount + count) > RLGL.State.listVertexCapacity)
+		{
+			int capacity = RLGL.State.listVertexCapacity;
+			while ((RLGL.State.listVertexCount + count) > capacity) capacity *= 2;
+			BatchVertex *vertices = (BatchVertex *)realloc(RLGL.State.listVertices, sizeof(BatchVertex)*capacity);
+			if (vertices == NULL)
+			{
+				debugNetPrintf(ERROR, "[ORBISGL] %s Display list vertex data could not be allocated, draw dropped\n",__FUNCTION__);
+				continue;
+			}
+			RLGL.State.listVertices = vertices;
+			RLGL.State.listVertexCapacity = capacity;
+		}
+		if (RLGL.State.listDrawsCount >= RLGL.State.listDrawsCapacity)
+		{
+			DrawCall *draws = (DrawCall *)realloc(RLGL.State.listDraws, sizeof(DrawCall)*RLGL.State.listDrawsCapacity*2);
+			if (draws == NULL)
+			{
+				debugNetPrintf(ERROR, "[ORBISGL] %s Display list draws could not be allocated, draw dropped\n",__FUNCTION__);
+				continue;
+			}
+			RLGL.State.listDraws = draws;
+			RLGL.State.listDrawsCapacity *= 2;
+		}
+		BatchVertex *dst = &RLGL.State.listVertices[RLGL.State.listVertexCount];
+		if (draw.mode == RL_QUADS)
+		{
+			for (int q = 0; q < draw.vertexCount/4; q++, src += 4, dst += 6)
+			{
+				dst[0] = src[0]; dst[1] = src[1]; dst[2] = src[2];
+				dst[3] = src[0]; dst[4] = src[2]; dst[5] = src[3];
+			}
+			draw.mode = RL_TRIANGLES;
+		}
+		else memcpy(dst, src, sizeof(BatchVertex)*count);
+		RLGL.State.listVertexCount += count;
+		draw.vertexCount = count;
+		draw.vertexAlignment = 0;
+		if ((RLGL.State.listDrawsCount > 0) && rlDrawsMergeable(&RLGL.State.listDraws[RLGL.State.listDrawsCount - 1], &draw)) RLGL.State.listDraws[RLGL.State.listDrawsCount - 1].vertexCount += count;
+		else RLGL.State.listDraws[RLGL.State.listDrawsCount++] = draw;
+	}
+	// Reset vertex counters and draws registry (buffer is not sent to GPU)
+	buffer->vCounter = 0;
+	buffer->tcCounter = 0;
+	buffer->cCounter = 0;
+	RLGL.State.currentDepth = -1.0f;
+	for (int i = 0; i < RLGL.State.maxDrawCalls; i++)
+	{
+		RLGL.State.draws[i].mode = RL_QUADS;
+		RLGL.State.draws[i].vertexCount = 0;
+		RLGL.State.draws[i].vertexAlignment = 0;
+		RLGL.State.draws[i].shader = RLGL.State.currentShader;
+		RLGL.State.draws[i].blendMode = RLGL.State.currentBlendMode;
+		RLGL.State.draws[i].textureId = RLGL.State.defaultTextureId;
+	}
+	RLGL.State.drawsCounter = 1;
+}
+
 // Unload default internal buffers vertex data from CPU and GPU
 void UnloadBuffersDefault(void)
 {
 	// Unbind everything
-	if (RLGL.ExtSupported.vao) glBindVertexArray(0);
+	if (RLGL.ExtSupported.vao) BindVertexArrayCached(0);
 	glDisableVertexAttribArray(0);
 	glDisableVertexAttribArray(1);
 	glDisableVertexAttribArray(2);
 	glDisableVertexAttribArray(3);
-	glBindBuffer(GL_ARRAY_BUFFER, 0);
-	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+	BindBufferCached(GL_ARRAY_BUFFER, 0);
+	BindBufferCached(GL_ELEMENT_ARRAY_BUFFER, 0);
 	for (int i = 0; i < MAX_BATCH_BUFFERING; i++)
 	{
 		// Delete VBOs from GPU (VRAM)
 		glDeleteBuffers(1, &RLGL.State.vertexData[i].vboId[0]);
 		glDeleteBuffers(1, &RLGL.State.vertexData[i].vboId[1]);
-		glDeleteBuffers(1, &RLGL.State.vertexData[i].vboId[2]);
-		glDeleteBuffers(1, &RLGL.State.vertexData[i].vboId[3]);
+		ForgetObjectCached(GL_ARRAY_BUFFER, RLGL.State.vertexData[i].vboId[0]);
+		ForgetObjectCached(GL_ARRAY_BUFFER, RLGL.State.vertexData[i].vboId[1]);
 		// Delete VAOs from GPU (VRAM)
 		if (RLGL.ExtSupported.vao) glDeleteVertexArrays(1, &RLGL.State.vertexData[i].vaoId);
+		ForgetObjectCached(GL_VERTEX_ARRAY_BINDING_OES, RLGL.State.vertexData[i].vaoId);
 		// Free vertex arrays memory from CPU (RAM)
 		free(RLGL.State.vertexData[i].vertices);
-		free(RLGL.State.vertexData[i].texcoords);
-		free(RLGL.State.vertexData[i].colors);
 		free(RLGL.State.vertexData[i].indices);
 	}
+	// Free draw calls and deferred transforms tracking system
+	free(RLGL.State.draws);
+	RLGL.State.draws = NULL;
+	free(RLGL.State.transformSpans);
+	RLGL.State.transformSpans = NULL;
+	free(RLGL.State.sortVertices);
+	free(RLGL.State.sortDraws);
+	RLGL.State.sortVertices = NULL;
+	RLGL.State.sortDraws = NULL;
+}
+
+// Merge draws of the unordered region by texture and mode
+// NOTE: Groups keep first appearance order and draws keep submission order inside
+// each group (stable), deferred transforms are applied before vertex are moved
+void SortBuffersDefault(void)
+{
+	DynamicBuffer *buffer = &RLGL.State.vertexData[RLGL.State.currentBuffer];
+	int first = RLGL.State.unorderedFirstDraw;
+	int last = RLGL.State.drawsCounter - 1;
+	if (last <= first) return;
+	int regionOffset = 0;
+	for (int i = 0; i < first; i++) regionOffset += (RLGL.State.draws[i].vertexCount + RLGL.State.draws[i].vertexAlignment);
+	// Group region draws by texture and mode (draws without vertex are dropped)
+	int drawsIn = 0;
+	int groups = 0;
+	for (int i = first; i <= last; i++)
+	{
+		if (RLGL.State.draws[i].vertexCount == 0) continue;
+		int g = 0;
+		while ((g < groups) && !rlDrawsMergeable(&RLGL.State.sortDraws[g], &RLGL.State.draws[i])) g++;
+		if (g == groups)
+		{
+			RLGL.State.sortDraws[g] = RLGL.State.draws[i];
+			RLGL.State.sortDraws[g].vertexCount = 0;
+			groups++;
+		}
+		RLGL.State.sortDraws[g].vertexCount += RLGL.State.draws[i].vertexCount;
+		drawsIn++;
+	}
+	if (groups == 0) return;
+	// Check merged layout fits in the batch (alignment could change)
+	int total = regionOffset;
+	for (int g = 0; g < groups; g++)
+	{
+		RLGL.State.sortDraws[g].vertexAlignment = (g < (groups - 1))? rlDrawAlignment(&RLGL.State.sortDraws[g]) : 0;
+		total += (RLGL.State.sortDraws[g].vertexCount + RLGL.State.sortDraws[g].vertexAlignment);
+	}
+	if (total > RLGL.State.batchElements*4) return;
+	TransformBuffersDefault();
+	memcpy(RLGL.State.sortVertices, &buffer->vertices[regionOffset], sizeof(BatchVertex)*(buffer->vCounter - regionOffset));
+	// Copy vertex ranges group by group
+	int offset = regionOffset;
+	for (int g = 0; g < groups; g++)
+	{
+		int src = 0;
+		for (int i = first; i <= last; i++)
+		{
+			if ((RLGL.State.draws[i].vertexCount > 0) && rlDrawsMergeable(&RLGL.State.draws[i], &RLGL.State.sortDraws[g]))
+			{
+				memcpy(&buffer->vertices[offset], &RLGL.State.sortVertices[src], sizeof(BatchVertex)*RLGL.State.draws[i].vertexCount);
+				offset += RLGL.State.draws[i].vertexCount;
+			}
+			src += (RLGL.State.draws[i].vertexCount + RLGL.State.draws[i].vertexAlignment);
+		}
+		offset += RLGL.State.sortDraws[g].vertexAlignment;
+	}
+	for (int g = 0; g < groups; g++) RLGL.State.draws[first + g] = RLGL.State.sortDraws[g];
+	for (int i = first + groups; i <= last; i++)
+	{
+		RLGL.State.draws[i].mode = RL_QUADS;
+		RLGL.State.draws[i].vertexCount = 0;
+		RLGL.State.draws[i].vertexAlignment = 0;
+		RLGL.State.draws[i].shader = RLGL.State.currentShader;
+		RLGL.State.draws[i].blendMode = RLGL.State.currentBlendMode;
+		RLGL.State.draws[i].textureId = RLGL.State.defaultTextureId;
+	}
+	RLGL.State.drawsCounter = first + groups;
+	buffer->vCounter = offset;
+	buffer->tcCounter = offset;
+	buffer->cCounter = offset;
+	RLGL.State.frameStats.unorderedDrawsIn += drawsIn;
+	RLGL.State.frameStats.unorderedDrawsOut += groups;
+}
+
+// Flush full default buffers in the middle of a primitive definition
+// NOTE: Vertex of the unfinished primitive (and texcoords/colors already provided
+// for it) are carried over to the next buffer, so no vertex is dropped
+void FlushBuffersDefault(void)
+{
+	DynamicBuffer *buffer = &RLGL.State.vertexData[RLGL.State.currentBuffer];
+	DrawCall *draw = &RLGL.State.draws[RLGL.State.drawsCounter - 1];
+	int mode = draw->mode;
+	unsigned int textureId = draw->textureId;
+	int primitive = (mode == RL_QUADS)? 4 : ((mode == RL_TRIANGLES)? 3 : 2);
+	int carry = draw->vertexCount%primitive;
+	int first = buffer->vCounter - carry;
+	int tcCarry = (buffer->tcCounter > first)? buffer->tcCounter - first : 0;
+	int cCarry = (buffer->cCounter > first)? buffer->cCounter - first : 0;
+	int count = carry;
+	if (tcCarry > count) count = tcCarry;
+	if (cCarry > count) count = cCarry;
+	if (count > 4) count = tcCarry = cCarry = 4;
+	BatchVertex carried[4];
+	memcpy(carried, &buffer->vertices[first], sizeof(BatchVertex)*count);
+	// Current color (last one set), taken by following vertex without color
+	if (buffer->cCounter > 0) memcpy(RLGL.State.flushColor, buffer->vertices[buffer->cCounter - 1].color, 4);
+	// Remove unfinished primitive from current batch and draw it
+	// NOTE: Texcoords and colors are padded up to vertex count, as rlEnd() does
+	draw->vertexCount -= carry;
+	buffer->vCounter = first;
+	for (int i = buffer->tcCounter; i < first; i++)
+	{
+		buffer->vertices[i].texcoord[0] = 0.0f;
+		buffer->vertices[i].texcoord[1] = 0.0f;
+	}
+	for (int i = buffer->cCounter; i < first; i++) memcpy(buffer->vertices[i].color, RLGL.State.flushColor, 4);
+	buffer->tcCounter = first;
+	buffer->cCounter = first;
+	RLGL.State.batchLimitFlushes++;
+	RLGL.State.flushCause = FLUSH_BUFFER_FULL;
+	rlglDraw();
+	// Restart unfinished primitive on the new buffer (carried vertex are still untransformed)
+	buffer = &RLGL.State.vertexData[RLGL.State.currentBuffer];
+	rlUpdateTransformSpan();
+	memcpy(buffer->vertices, carried, sizeof(BatchVertex)*count);
+	for (int i = tcCarry; i < carry; i++)
+	{
+		buffer->vertices[i].texcoord[0] = 0.0f;
+		buffer->vertices[i].texcoord[1] = 0.0f;
+	}
+	for (int i = cCarry; i < carry; i++) memcpy(buffer->vertices[i].color, RLGL.State.flushColor, 4);
+	buffer->vCounter = carry;
+	buffer->tcCounter = (tcCarry > carry)? tcCarry : carry;
+	buffer->cCounter = (cCarry > carry)? cCarry : carry;
+	RLGL.State.draws[0].mode = mode;
+	RLGL.State.draws[0].textureId = textureId;
+	RLGL.State.draws[0].vertexCount = carry;
 }
 
 // Renders a 1x1 XY quad in NDC
@@ -2463,10 +5316,10 @@ void GenDrawQuad(void)
     // Set up plane VAO
     glGenVertexArrays(1, &quadVAO);
     glGenBuffers(1, &quadVBO);
-    glBindVertexArray(quadVAO);
+    BindVertexArrayCached(quadVAO);
 
     // Fill buffer
-    glBindBuffer(GL_ARRAY_BUFFER, quadVBO);
+    BindBufferCached(GL_ARRAY_BUFFER, quadVBO);
     glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), &vertices, GL_STATIC_DRAW);
 
     // Link vertex attributes
@@ -2476,12 +5329,15 @@ void GenDrawQuad(void)
     glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, 5*sizeof(float), (void *)(3*sizeof(float)));
 
     // Draw quad
-    glBindVertexArray(quadVAO);
+    BindVertexArrayCached(quadVAO);
     glDrawArrays(GL_TRIANGLE_STRIP, 0, 4);
-    glBindVertexArray(0);
+    RLGL.State.frameStats.drawCalls++;
+    BindVertexArrayCached(0);
 
     glDeleteBuffers(1, &quadVBO);
     glDeleteVertexArrays(1, &quadVAO);
+    ForgetObjectCached(GL_ARRAY_BUFFER, quadVBO);
+    ForgetObjectCached(GL_VERTEX_ARRAY_BINDING_OES, quadVAO);
 }
 
 // Renders a 1x1 3D cube in NDC
@@ -2531,24 +5387,27 @@ void GenDrawCube(void)
 	glGenVertexArrays(1, &cubeVAO);
 	glGenBuffers(1, &cubeVBO);
 	// Fill buffer
-	glBindBuffer(GL_ARRAY_BUFFER, cubeVBO);
+	BindBufferCached(GL_ARRAY_BUFFER, cubeVBO);
 	glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_STATIC_DRAW);
 	// Link vertex attributes
-	glBindVertexArray(cubeVAO);
+	BindVertexArrayCached(cubeVAO);
 	glEnableVertexAttribArray(0);
 	glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 8*sizeof(float), (void *)0);
 	glEnableVertexAttribArray(1);
 	glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, 8*sizeof(float), (void *)(3*sizeof(float)));
 	glEnableVertexAttribArray(2);
 	glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, 8*sizeof(float), (void *)(6*sizeof(float)));
-	glBindBuffer(GL_ARRAY_BUFFER, 0);
-	glBindVertexArray(0);
+	BindBufferCached(GL_ARRAY_BUFFER, 0);
+	BindVertexArrayCached(0);
 	// Draw cube
-	glBindVertexArray(cubeVAO);
+	BindVertexArrayCached(cubeVAO);
 	glDrawArrays(GL_TRIANGLES, 0, 36);
-	glBindVertexArray(0);
+	RLGL.State.frameStats.drawCalls++;
+	BindVertexArrayCached(0);
 	glDeleteBuffers(1, &cubeVBO);
 	glDeleteVertexArrays(1, &cubeVAO);
+	ForgetObjectCached(GL_ARRAY_BUFFER, cubeVBO);
+	ForgetObjectCached(GL_VERTEX_ARRAY_BINDING_OES, cubeVAO);
 }
 
 
@@ -53,6 +53,7 @@
 **********************************************************************************************/
 #include <orbisGl2.h>
 
+#include <stdio.h>
 #include <stdlib.h>
 #include <debugnet.h>
 #include <orbisNfs.h>
@@ -300,6 +301,7 @@ Font LoadFont(const char *fileName)
 // if array is NULL, default char set is selected 32..126
 Font LoadFontEx(const char *fileName, int fontSize, int *fontChars, int charsCount)
 {
+	BeginProfileScope("LoadFontEx");
 	Font font = { 0 };
 	
 	font.baseSize = fontSize;
@@ -327,6 +329,7 @@ Font LoadFontEx(const char *fileName, int fontSize, int *fontChars, int charsCou
 	font = GetFontDefault();
 #endif
 
+    EndProfileScope();
     return font;
 }
 
@@ -73,7 +73,45 @@
 #include <string.h>
 #include <stdarg.h>
 #include <math.h>
+#include "stb_rect_pack.h"         // Required for: runtime texture atlas packing (implementation on text module)
 #define PNG_SIGSIZE (8)
+#define SPRITES_BATCH_CHUNK 128    // Sprites built on stack before pushing them to the batch
+#define ATLAS_MAX_ENTRIES 1024     // Maximum number of textures packed on runtime atlas
+#define ATLAS_PADDING 1            // Empty pixels around packed textures (avoids filtering bleeding)
+
+// Runtime atlas page, a shared GL texture with its packing context
+typedef struct AtlasPage {
+	unsigned int id;               // OpenGL texture id
+	stbrp_context context;         // Packing context (skyline)
+	stbrp_node *nodes;             // Packing nodes, one per page column
+	int usedArea;                  // Pixels used by packed textures
+} AtlasPage;
+
+// Runtime atlas entry, region of a page owned by a texture
+// NOTE: Released entries keep their packed region, reused by next textures fitting on it
+typedef struct AtlasEntry {
+	int page;                      // Page index
+	int x;                         // Texture position in page
+	int y;
+	int width;                     // Texture size
+	int height;
+	int regionWidth;               // Packed region size, padding included (0 if entry has no region)
+	int regionHeight;
+	unsigned int generation;       // Incremented when entry is released, textures keep the generation they were packed with
+	bool used;                     // Entry owned by a loaded texture
+} AtlasEntry;
+
+extern rlglData RLGL;
+
+static struct {
+	bool enabled;                  // Small textures packed on load
+	int pageSize;                  // Page width and height
+	int maxTextureSize;            // Maximum packed texture width/height
+	AtlasPage pages[ATLAS_MAX_PAGES];
+	int pagesCount;
+	AtlasEntry entries[ATLAS_MAX_ENTRIES];
+	int rejectedCount;
+} atlas = { 0 };
 #if defined(SUPPORT_IMAGE_GENERATION)
     #define STB_PERLIN_IMPLEMENTATION
     #include <stb_perlin.h>        // Required for: stb_perlin_fbm_noise3
@@ -259,17 +297,20 @@ error_create_read:
 Image LoadImage(const char *fileName)
 {
 	debugNetPrintf(DEBUG,"[ORBISGL] %s \n",__FUNCTION__);
+	BeginProfileScope("LoadImage");
 	Image image = { 0 };
 	unsigned char *buf=orbisNfsGetFileContent(fileName);
 	if(buf)
 	{
 		if(png_sig_cmp((png_byte *)buf,0,PNG_SIGSIZE)!=0) 
 		{
+			EndProfileScope();
 			return image;
 		}
 		uint64_t buffer_address=(uint64_t)buf+PNG_SIGSIZE;
-		return orbisGlLoadPngGeneric((void *)&buffer_address,orbisGlReadPngFromBuffer);
+		image=orbisGlLoadPngGeneric((void *)&buffer_address,orbisGlReadPngFromBuffer);
 	}
+	EndProfileScope();
 	return image;
 }
 
@@ -354,6 +395,194 @@ Image LoadImageRaw(const char *fileName, int width, int height, int format, int
 	return image;
 }
 
+// Enable runtime texture atlas, textures up to maxTextureSize loaded afterwards are packed into shared pages
+// NOTE: Packed textures draw on the same batch entry, so sprites from different textures don't split batches
+void InitTextureAtlas(int pageSize, int maxTextureSize)
+{
+	if (atlas.enabled) CloseTextureAtlas();
+	atlas.pageSize = pageSize;
+	atlas.maxTextureSize = (maxTextureSize < (pageSize - 2*ATLAS_PADDING))? maxTextureSize : (pageSize - 2*ATLAS_PADDING);
+	atlas.pagesCount = 0;
+	atlas.rejectedCount = 0;
+	atlas.enabled = true;
+	debugNetPrintf(INFO, "[ORBISGL] %s Runtime texture atlas enabled (%ix%i pages, textures up to %i)\n",__FUNCTION__, pageSize, pageSize, atlas.maxTextureSize);
+}
+
+// Unload runtime atlas pages
+// NOTE: Textures packed on the atlas become invalid
+void CloseTextureAtlas(void)
+{
+	for (int i = 0; i < atlas.pagesCount; i++)
+	{
+		rlDeleteTextures(atlas.pages[i].id);
+		free(atlas.pages[i].nodes);
+		atlas.pages[i].id = 0;
+		atlas.pages[i].nodes = NULL;
+	}
+	for (int i = 0; i < ATLAS_MAX_ENTRIES; i++)
+	{
+		if (atlas.entries[i].used) atlas.entries[i].generation++;
+		atlas.entries[i].used = false;
+		atlas.entries[i].regionWidth = 0;
+		atlas.entries[i].regionHeight = 0;
+	}
+	atlas.pagesCount = 0;
+	atlas.enabled = false;
+}
+
+// Get runtime atlas packing stats
+TextureAtlasStats GetTextureAtlasStats(void)
+{
+	TextureAtlasStats stats = { 0 };
+	int pageArea = atlas.pageSize*atlas.pageSize;
+	stats.pageSize = atlas.pageSize;
+	stats.pagesCount = atlas.pagesCount;
+	stats.rejectedCount = atlas.rejectedCount;
+	for (int i = 0; i < ATLAS_MAX_ENTRIES; i++) if (atlas.entries[i].used) stats.texturesCount++;
+	for (int i = 0; i < atlas.pagesCount; i++)
+	{
+		stats.pageFill[i] = (float)atlas.pages[i].usedArea/pageArea;
+		stats.usedArea += atlas.pages[i].usedArea;
+	}
+	stats.wastedArea = atlas.pagesCount*pageArea - stats.usedArea;
+	if (atlas.pagesCount > 0) stats.fill = (float)stats.usedArea/(atlas.pagesCount*pageArea);
+	return stats;
+}
+
+// Pack image into a runtime atlas page, a new page is created if it doesn't fit on existing ones
+// NOTE: Regions released by unloaded textures are reused first (smallest fitting one), a region is
+// reused whole, its spare pixels stay wasted until the entry is reused again or the atlas is closed
+// NOTE: Returned texture has page id, image size and atlasEntry set; texture id is 0 if not packed
+static Texture2D PackTextureAtlas(Image image)
+{
+	Texture2D texture = { 0 };
+	stbrp_rect rect = { 0 };
+	rect.w = image.width + 2*ATLAS_PADDING;
+	rect.h = image.height + 2*ATLAS_PADDING;
+	// Free entry: smallest released region fitting the image, else an entry without region
+	int entry = ATLAS_MAX_ENTRIES;
+	int empty = ATLAS_MAX_ENTRIES;
+	for (int i = 0; i < ATLAS_MAX_ENTRIES; i++)
+	{
+		if (atlas.entries[i].used) continue;
+		if (atlas.entries[i].regionWidth == 0) { if (empty == ATLAS_MAX_ENTRIES) empty = i; }
+		else if ((atlas.entries[i].regionWidth >= rect.w) && (atlas.entries[i].regionHeight >= rect.h) && ((entry == ATLAS_MAX_ENTRIES) ||
+			(atlas.entries[i].regionWidth*atlas.entries[i].regionHeight < atlas.entries[entry].regionWidth*atlas.entries[entry].regionHeight))) entry = i;
+	}
+	bool reused = (entry < ATLAS_MAX_ENTRIES);
+	if (!reused) entry = empty;
+	if (!reused && (entry == ATLAS_MAX_ENTRIES))
+	{
+		// Every free entry holds a region too small for the image, first one gives up its region
+		for (entry = 0; (entry < ATLAS_MAX_ENTRIES) && atlas.entries[entry].used; entry++);
+	}
+	if ((image.width > atlas.maxTextureSize) || (image.height > atlas.maxTextureSize) || (image.mipmaps > 1) ||
+		(image.format >= COMPRESSED_DXT1_RGB) || (entry == ATLAS_MAX_ENTRIES))
+	{
+		atlas.rejectedCount++;
+		return texture;
+	}
+	int page = 0;
+	if (reused)
+	{
+		page = atlas.entries[entry].page;
+		rect.x = atlas.entries[entry].x - ATLAS_PADDING;
+		rect.y = atlas.entries[entry].y - ATLAS_PADDING;
+		rect.w = atlas.entries[entry].regionWidth;
+		rect.h = atlas.entries[entry].regionHeight;
+	}
+	else
+	{
+		for (; page < atlas.pagesCount; page++)
+		{
+			stbrp_pack_rects(&atlas.pages[page].context, &rect, 1);
+			if (rect.was_packed) break;
+		}
+	}
+	if (page == atlas.pagesCount)
+	{
+		if (atlas.pagesCount == ATLAS_MAX_PAGES)
+		{
+			atlas.rejectedCount++;
+			return texture;
+		}
+		// New page, cleared to transparent so padding never bleeds garbage
+		void *blank = calloc(atlas.pageSize*atlas.pageSize, 4);
+		atlas.pages[page].id = rlLoadTexture(blank, atlas.pageSize, atlas.pageSize, UNCOMPRESSED_R8G8B8A8, 1);
+		free(blank);
+		if (atlas.pages[page].id == 0)
+		{
+			atlas.rejectedCount++;
+			return texture;
+		}
+		atlas.pages[page].nodes = (stbrp_node *)malloc(sizeof(stbrp_node)*atlas.pageSize);
+		atlas.pages[page].usedArea = 0;
+		stbrp_init_target(&atlas.pages[page].context, atlas.pageSize, atlas.pageSize, atlas.pages[page].nodes, atlas.pageSize);
+		atlas.pagesCount++;
+		stbrp_pack_rects(&atlas.pages[page].context, &rect, 1);
+		debugNetPrintf(INFO, "[ORBISGL] %s [TEX ID %i] Runtime atlas page %i created\n",__FUNCTION__, atlas.pages[page].id, page);
+	}
+	// Atlas pages are RGBA, other uncompressed formats are converted
+	Image pixels = image;
+	if (image.format != UNCOMPRESSED_R8G8B8A8)
+	{
+		pixels = ImageCopy(image);
+		ImageFormat(&pixels, UNCOMPRESSED_R8G8B8A8);
+	}
+	atlas.entries[entry] = (AtlasEntry){ page, rect.x + ATLAS_PADDING, rect.y + ATLAS_PADDING, image.width, image.height, rect.w, rect.h, atlas.entries[entry].generation, true };
+	if (reused)
+	{
+		// Reused region is cleared around the image, previous texture pixels would bleed through padding
+		unsigned char *region = (unsigned char *)calloc(rect.w*rect.h, 4);
+		if (region != NULL)
+		{
+			for (int y = 0; y < image.height; y++) memcpy(region + ((y + ATLAS_PADDING)*rect.w + ATLAS_PADDING)*4, (unsigned char *)pixels.data + y*image.width*4, image.width*4);
+			rlUpdateTextureRec(atlas.pages[page].id, rect.x, rect.y, rect.w, rect.h, UNCOMPRESSED_R8G8B8A8, region);
+			free(region);
+		}
+		else rlUpdateTextureRec(atlas.pages[page].id, atlas.entries[entry].x, atlas.entries[entry].y, image.width, image.height, UNCOMPRESSED_R8G8B8A8, pixels.data);
+	}
+	else rlUpdateTextureRec(atlas.pages[page].id, atlas.entries[entry].x, atlas.entries[entry].y, image.width, image.height, UNCOMPRESSED_R8G8B8A8, pixels.data);
+	if (pixels.data != image.data) UnloadImage(pixels);
+	atlas.pages[page].usedArea += image.width*image.height;
+	texture.id = atlas.pages[page].id;
+	texture.width = image.width;
+	texture.height = image.height;
+	texture.mipmaps = 1;
+	texture.format = UNCOMPRESSED_R8G8B8A8;
+	texture.atlasEntry = entry + 1;
+	texture.atlasGeneration = atlas.entries[entry].generation;
+	return texture;
+}
+
+// Get atlas entry owned by a packed texture, NULL if entry was released (unloaded texture or atlas closed)
+static AtlasEntry *GetTextureAtlasEntry(Texture2D texture)
+{
+	if ((texture.atlasEntry <= 0) || (texture.atlasEntry > ATLAS_MAX_ENTRIES)) return NULL;
+	AtlasEntry *entry = &atlas.entries[texture.atlasEntry - 1];
+	if (!entry->used || (entry->generation != texture.atlasGeneration)) return NULL;
+	return entry;
+}
+
+// Get texture region on its GL texture: offset and full GL texture size
+// NOTE: Textures not packed on the atlas cover their whole GL texture, returns false for stale packed textures
+static bool GetTextureAtlasRegion(Texture2D texture, Vector2 *offset, Vector2 *size)
+{
+	if (texture.atlasEntry > 0)
+	{
+		AtlasEntry *entry = GetTextureAtlasEntry(texture);
+		if (entry == NULL) return false;
+		*offset = (Vector2){ (float)entry->x, (float)entry->y };
+		*size = (Vector2){ (float)atlas.pageSize, (float)atlas.pageSize };
+	}
+	else
+	{
+		*offset = (Vector2){ 0.0f, 0.0f };
+		*size = (Vector2){ (float)texture.width, (float)texture.height };
+	}
+	return true;
+}
+
 Texture2D LoadTexture(const char *fileName)
 {
 	Texture2D texture = { 0 };
@@ -387,6 +616,18 @@ Texture2D LoadTextureFromImage(Image image)
 	return texture;
 }
 
+// Load texture packed into a runtime atlas page
+// NOTE: Falls back to a standalone texture if atlas is not enabled or image can't be packed
+Texture2D LoadTextureAtlasFromImage(Image image)
+{
+	if (atlas.enabled && (image.data != NULL) && (image.width != 0) && (image.height != 0))
+	{
+		Texture2D texture = PackTextureAtlas(image);
+		if (texture.id > 0) return texture;
+	}
+	return LoadTextureFromImage(image);
+}
+
 RenderTexture2D LoadRenderTexture(int width, int height)
 {
 	RenderTexture2D target = rlLoadRenderTexture(width, height, UNCOMPRESSED_R8G8B8A8, 24, false);
@@ -400,6 +641,18 @@ void UnloadImage(Image image)
 
 void UnloadTexture(Texture2D texture)
 {
+    if (texture.atlasEntry > 0)
+    {
+        // NOTE: Page region stays with the entry, reused by next packed texture fitting on it
+        AtlasEntry *entry = GetTextureAtlasEntry(texture);
+        if (entry != NULL)
+        {
+            entry->used = false;
+            entry->generation++;
+            atlas.pages[entry->page].usedArea -= entry->width*entry->height;
+        }
+        return;
+    }
     if (texture.id > 0)
     {
         rlDeleteTextures(texture.id);
@@ -693,7 +946,20 @@ Image GetTextureData(Texture2D texture)
 	Image image = { 0 };
 	if (texture.format < 8)
 	{
-		image.data = rlReadTexturePixels(texture);
+		if (texture.atlasEntry > 0)
+		{
+			// Read whole atlas page and keep texture region rows (RGBA)
+			AtlasEntry *entry = GetTextureAtlasEntry(texture);
+			Texture2D page = { .id = texture.id, .width = atlas.pageSize, .height = atlas.pageSize, .mipmaps = 1, .format = UNCOMPRESSED_R8G8B8A8 };
+			unsigned char *pagePixels = (entry != NULL)? (unsigned char *)rlReadTexturePixels(page) : NULL;
+			if (pagePixels != NULL)
+			{
+				image.data = malloc(texture.width*texture.height*4);
+				for (int y = 0; y < texture.height; y++) memcpy((unsigned char *)image.data + y*texture.width*4, pagePixels + ((entry->y + y)*atlas.pageSize + entry->x)*4, texture.width*4);
+				free(pagePixels);
+			}
+		}
+		else image.data = rlReadTexturePixels(texture);
 		if (image.data != NULL)
 		{
 			image.width = texture.width;
@@ -730,7 +996,17 @@ Image GetScreenData(void)
 // NOTE: pixels data must match texture.format
 void UpdateTextureFromPixels(Texture2D texture, const void *pixels)
 {
-    rlUpdateTexture(texture.id, texture.width, texture.height, texture.format, pixels);
+    if (texture.atlasEntry > 0)
+    {
+        AtlasEntry *entry = GetTextureAtlasEntry(texture);
+        if (entry == NULL)
+        {
+            debugNetPrintf(ERROR, "[ORBISGL] %s Packed texture was unloaded, it can't be updated\n",__FUNCTION__);
+            return;
+        }
+        rlUpdateTextureRec(texture.id, entry->x, entry->y, entry->width, entry->height, texture.format, pixels);
+    }
+    else rlUpdateTexture(texture.id, texture.width, texture.height, texture.format, pixels);
 }
 
 
@@ -2441,6 +2717,60 @@ void DrawTextureQuad(Texture2D texture, Vector2 tiling, Vector2 offset, Rectangl
 	DrawTexturePro(texture, source, quad, origin, 0.0f, tint);
 }
 
+// Build sprite quad vertex (top-left, bottom-left, bottom-right, top-right)
+// NOTE: Corners are rotated around origin with a single sin/cos, no matrix involved
+static void SetSpriteQuad(BatchVertex *quad, float width, float height, const SpriteInstance *sprite, float depth)
+{
+	Rectangle sourceRec = sprite->sourceRec;
+	Rectangle destRec = sprite->destRec;
+	bool flipX = false;
+	if (sourceRec.width < 0) { flipX = true; sourceRec.width *= -1; }
+	if (sourceRec.height < 0) sourceRec.y -= sourceRec.height;
+	float dx = -sprite->origin.x;
+	float dy = -sprite->origin.y;
+	if (sprite->rotation == 0.0f)
+	{
+		float x = destRec.x + dx;
+		float y = destRec.y + dy;
+		quad[0].position[0] = x; quad[0].position[1] = y;
+		quad[1].position[0] = x; quad[1].position[1] = y + destRec.height;
+		quad[2].position[0] = x + destRec.width; quad[2].position[1] = y + destRec.height;
+		quad[3].position[0] = x + destRec.width; quad[3].position[1] = y;
+	}
+	else
+	{
+		float sinRotation = sinf(sprite->rotation*DEG2RAD);
+		float cosRotation = cosf(sprite->rotation*DEG2RAD);
+		float x = destRec.x;
+		float y = destRec.y;
+		quad[0].position[0] = x + dx*cosRotation - dy*sinRotation;
+		quad[0].position[1] = y + dx*sinRotation + dy*cosRotation;
+		quad[1].position[0] = x + dx*cosRotation - (dy + destRec.height)*sinRotation;
+		quad[1].position[1] = y + dx*sinRotation + (dy + destRec.height)*cosRotation;
+		quad[2].position[0] = x + (dx + destRec.width)*cosRotation - (dy + destRec.height)*sinRotation;
+		quad[2].position[1] = y + (dx + destRec.width)*sinRotation + (dy + destRec.height)*cosRotation;
+		quad[3].position[0] = x + (dx + destRec.width)*cosRotation - dy*sinRotation;
+		quad[3].position[1] = y + (dx + destRec.width)*sinRotation + dy*cosRotation;
+	}
+	float left = sourceRec.x/width;
+	float right = (sourceRec.x + sourceRec.width)/width;
+	float top = sourceRec.y/height;
+	float bottom = (sourceRec.y + sourceRec.height)/height;
+	if (flipX) { float swap = left; left = right; right = swap; }
+	quad[0].texcoord[0] = left; quad[0].texcoord[1] = top;
+	quad[1].texcoord[0] = left; quad[1].texcoord[1] = bottom;
+	quad[2].texcoord[0] = right; quad[2].texcoord[1] = bottom;
+	quad[3].texcoord[0] = right; quad[3].texcoord[1] = top;
+	for (int i = 0; i < 4; i++)
+	{
+		quad[i].position[2] = depth;
+		quad[i].color[0] = sprite->tint.r;
+		quad[i].color[1] = sprite->tint.g;
+		quad[i].color[2] = sprite->tint.b;
+		quad[i].color[3] = sprite->tint.a;
+	}
+}
+
 // Draw a part of a texture (defined by a rectangle) with 'pro' parameters
 // NOTE: origin is relative to destination rectangle size
 void DrawTexturePro(Texture2D texture, Rectangle sourceRec, Rectangle destRec, Vector2 origin, float rotation, Color tint)
@@ -2448,37 +2778,42 @@ void DrawTexturePro(Texture2D texture, Rectangle sourceRec, Rectangle destRec, V
 	// Check if texture is valid
 	if (texture.id > 0)
 	{
-		float width = (float)texture.width;
-		float height = (float)texture.height;
-		bool flipX = false;
-		if (sourceRec.width < 0) { flipX = true; sourceRec.width *= -1; }
-		if (sourceRec.height < 0) sourceRec.y -= sourceRec.height;
+		Vector2 offset, size;
+		if (!GetTextureAtlasRegion(texture, &offset, &size)) return;
+		SpriteInstance sprite = { sourceRec, destRec, origin, rotation, tint };
+		sprite.sourceRec.x += offset.x;
+		sprite.sourceRec.y += offset.y;
+		BatchVertex quad[4];
+		SetSpriteQuad(quad, size.x, size.y, &sprite, GetBatchDepth());
 		rlEnableTexture(texture.id);
-		rlPushMatrix();
-			rlTranslatef(destRec.x, destRec.y, 0.0f);
-			rlRotatef(rotation, 0.0f, 0.0f, 1.0f);
-			rlTranslatef(-origin.x, -origin.y, 0.0f);
-			rlBegin(RL_QUADS);
-				rlColor4ub(tint.r, tint.g, tint.b, tint.a);
-				rlNormal3f(0.0f, 0.0f, 1.0f);                          // Normal vector pointing towards viewer
-				// Bottom-left corner for texture and quad
-				if (flipX) rlTexCoord2f((sourceRec.x + sourceRec.width)/width, sourceRec.y/height);
-				else rlTexCoord2f(sourceRec.x/width, sourceRec.y/height);
-				rlVertex2f(0.0f, 0.0f);
-				// Bottom-right corner for texture and quad
-				if (flipX) rlTexCoord2f((sourceRec.x + sourceRec.width)/width, (sourceRec.y + sourceRec.height)/height);
-				else rlTexCoord2f(sourceRec.x/width, (sourceRec.y + sourceRec.height)/height);
-				rlVertex2f(0.0f, destRec.height);
-				// Top-right corner for texture and quad
-				if (flipX) rlTexCoord2f(sourceRec.x/width, (sourceRec.y + sourceRec.height)/height);
-				else rlTexCoord2f((sourceRec.x + sourceRec.width)/width, (sourceRec.y + sourceRec.height)/height);
-				rlVertex2f(destRec.width, destRec.height);
-				// Top-left corner for texture and quad
-				if (flipX) rlTexCoord2f(sourceRec.x/width, sourceRec.y/height);
-				else rlTexCoord2f((sourceRec.x + sourceRec.width)/width, sourceRec.y/height);
-				rlVertex2f(destRec.width, 0.0f);
-			rlEnd();
-		rlPopMatrix();
+		rlPushQuads(quad, 1);
+		rlDisableTexture();
+	}
+}
+
+// Draw multiple sprites from the same texture
+// NOTE: Sprites are built in chunks and pushed to the batch without per sprite state changes
+void DrawSprites(Texture2D texture, const SpriteInstance *sprites, int count)
+{
+	// Check if texture is valid
+	if ((texture.id > 0) && (sprites != NULL))
+	{
+		BatchVertex quads[4*SPRITES_BATCH_CHUNK];
+		Vector2 offset, size;
+		if (!GetTextureAtlasRegion(texture, &offset, &size)) return;
+		rlEnableTexture(texture.id);
+		for (int i = 0; i < count; i += SPRITES_BATCH_CHUNK)
+		{
+			int chunk = ((count - i) < SPRITES_BATCH_CHUNK)? (count - i) : SPRITES_BATCH_CHUNK;
+			for (int j = 0; j < chunk; j++)
+			{
+				SpriteInstance sprite = sprites[i + j];
+				sprite.sourceRec.x += offset.x;
+				sprite.sourceRec.y += offset.y;
+				SetSpriteQuad(&quads[4*j], size.x, size.y, &sprite, GetBatchDepth());
+			}
+			rlPushQuads(quads, chunk);
+		}
 		rlDisableTexture();
 	}
 }
@@ -2488,12 +2823,16 @@ void DrawTextureNPatch(Texture2D texture, NPatchInfo nPatchInfo, Rectangle destR
 {
 	if (texture.id > 0)
 	{
-		float width = (float)texture.width;
-		float height = (float)texture.height;
+		Vector2 offset, size;
+		if (!GetTextureAtlasRegion(texture, &offset, &size)) return;
+		float width = size.x;
+		float height = size.y;
 		float patchWidth = (destRec.width <= 0.0f)? 0.0f : destRec.width;
 		float patchHeight = (destRec.height <= 0.0f)? 0.0f : destRec.height;
 		if (nPatchInfo.sourceRec.width < 0) nPatchInfo.sourceRec.x -= nPatchInfo.sourceRec.width;
 		if (nPatchInfo.sourceRec.height < 0) nPatchInfo.sourceRec.y -= nPatchInfo.sourceRec.height;
+		nPatchInfo.sourceRec.x += offset.x;
+		nPatchInfo.sourceRec.y += offset.y;
 		if (nPatchInfo.type == NPT_3PATCH_HORIZONTAL) patchHeight = nPatchInfo.sourceRec.height;
 		if (nPatchInfo.type == NPT_3PATCH_VERTICAL) patchWidth = nPatchInfo.sourceRec.width;
 		bool drawCenter = true;